@@ -1,142 +1,738 @@
 #include <iostream>
 #include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <cstdint>
+#include <stdexcept>
+#include <sstream>
+#include <iterator>
+#include <cmath>
+#include <functional>
+#include <utility>
 namespace STD{
-template<typename T, int N>
-class Array{
-    template<typename U, int UN> friend std::ostream& operator<< (std::ostream& os, const Array<U, UN>& Arr);
-  public:
-    Array() = default;
-    Array(const std::initializer_list<T> lst) {
-        int i = 0;
-        for(auto& val: lst) {
-            arr[i] = val;
-            i++;
+// * SIMD kernels(與Custom_Vector.cpp中的實作相同；每個檔案都是獨立編譯的範例，因此各自保留一份)：
+//   Packed<T, Bytes>以vector extension撰寫一次迴圈，由Sse2/Avx2/Avx512包裝層依執行時的CPUID選用。
+namespace simd{
+template<typename T>
+inline constexpr bool kVectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                                      !std::is_same_v<T, long double>;
+
+template<typename T>
+struct Scalar{
+    static constexpr void Fill(T* p, std::size_t n, const T& val) {
+        for(std::size_t i = 0; i < n; i++) {
+            p[i] = val;
         }
     }
-    Array(const Array& other) {
-        for(int i = 0; i < N; i++) {
-            arr[i] = other.arr[i];
+    static constexpr std::size_t Find(const T* p, std::size_t n, const T& val) {
+        for(std::size_t i = 0; i < n; i++) {
+            if(p[i] == val) return i;
         }
+        return n;
     }
-    Array& operator=(const Array& other) {
-        if(&other == this) return *this;
-        for(int i = 0; i < N; i++) {
-            arr[i] = other.arr[i];
+    static constexpr std::size_t Count(const T* p, std::size_t n, const T& val) {
+        std::size_t cnt = 0;
+        for(std::size_t i = 0; i < n; i++) {
+            if(p[i] == val) cnt++;
+        }
+        return cnt;
+    }
+    static constexpr T Min(const T* p, std::size_t n) {
+        T res = p[0];
+        for(std::size_t i = 1; i < n; i++) {
+            if(p[i] < res) res = p[i];
+        }
+        return res;
+    }
+    static constexpr T Max(const T* p, std::size_t n) {
+        T res = p[0];
+        for(std::size_t i = 1; i < n; i++) {
+            if(res < p[i]) res = p[i];
+        }
+        return res;
+    }
+    static constexpr T Sum(const T* p, std::size_t n) {
+        T res{};
+        for(std::size_t i = 0; i < n; i++) {
+            res += p[i];
+        }
+        return res;
+    }
+    static constexpr T Dot(const T* a, const T* b, std::size_t n) {
+        T res{};
+        for(std::size_t i = 0; i < n; i++) {
+            res += a[i] * b[i];
+        }
+        return res;
+    }
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+template<typename T, int Bytes>
+struct Packed{
+    typedef T V __attribute__((vector_size(Bytes)));
+    typedef T Unaligned __attribute__((vector_size(Bytes), aligned(alignof(T)), __may_alias__));
+    using Mask = decltype(V{} == V{});          // * 比較結果：每個lane為0或-1的同寬整數向量。
+    static constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+    // * 以不要求對齊的向量型別讀寫任意位址(同_mm256_loadu_ps)，以指標傳遞以免向量在函式邊界上傳值。
+    __attribute__((always_inline)) static const Unaligned* At(const T* p) {
+        return reinterpret_cast<const Unaligned*>(p);
+    }
+    __attribute__((always_inline)) static bool Any(const Mask& m) {
+        const Mask zero{};
+        return std::memcmp(&m, &zero, sizeof(Mask)) != 0;
+    }
+    __attribute__((always_inline)) static void Fill(T* p, std::size_t n, T val) {
+        const V v = V{} + val;
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            *reinterpret_cast<Unaligned*>(p + i) = v;
+        }
+        Scalar<T>::Fill(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static std::size_t Find(const T* p, std::size_t n, T val) {
+        const V v = V{} + val;
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            Mask m = *At(p + i) == v;
+            if(Any(m)) {
+                for(std::size_t j = 0; j < kLanes; j++) {
+                    if(m[j]) return i + j;
+                }
+            }
+        }
+        return i + Scalar<T>::Find(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static std::size_t Count(const T* p, std::size_t n, T val) {
+        // * 每個lane以-1累減計數；lane只有sizeof(T)寬，因此每隔kFlush個區塊就把計數倒回size_t以免溢位。
+        constexpr std::size_t kFlush = sizeof(T) == 1 ? 127 : sizeof(T) == 2 ? 32767 : (1u << 30);
+        const V v = V{} + val;
+        Mask acc{};
+        std::size_t cnt = 0, blocks = 0, i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc -= (*At(p + i) == v);
+            if(++blocks == kFlush) {
+                for(std::size_t j = 0; j < kLanes; j++) cnt += acc[j];
+                acc = Mask{};
+                blocks = 0;
+            }
+        }
+        for(std::size_t j = 0; j < kLanes; j++) cnt += acc[j];
+        return cnt + Scalar<T>::Count(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static T Min(const T* p, std::size_t n) {
+        if(n < kLanes) return Scalar<T>::Min(p, n);
+        V acc = *At(p);
+        std::size_t i = kLanes;
+        for(; i + kLanes <= n; i += kLanes) {
+            V x = *At(p + i);
+            acc = x < acc ? x : acc;
+        }
+        T res = acc[0];
+        for(std::size_t j = 1; j < kLanes; j++) {
+            if(acc[j] < res) res = acc[j];
+        }
+        for(; i < n; i++) {
+            if(p[i] < res) res = p[i];
+        }
+        return res;
+    }
+    __attribute__((always_inline)) static T Max(const T* p, std::size_t n) {
+        if(n < kLanes) return Scalar<T>::Max(p, n);
+        V acc = *At(p);
+        std::size_t i = kLanes;
+        for(; i + kLanes <= n; i += kLanes) {
+            V x = *At(p + i);
+            acc = acc < x ? x : acc;
         }
+        T res = acc[0];
+        for(std::size_t j = 1; j < kLanes; j++) {
+            if(res < acc[j]) res = acc[j];
+        }
+        for(; i < n; i++) {
+            if(res < p[i]) res = p[i];
+        }
+        return res;
+    }
+    __attribute__((always_inline)) static T Sum(const T* p, std::size_t n) {
+        V acc{};
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc += *At(p + i);
+        }
+        T res = Scalar<T>::Sum(p + i, n - i);
+        for(std::size_t j = 0; j < kLanes; j++) res += acc[j];
+        return res;
+    }
+    __attribute__((always_inline)) static T Dot(const T* a, const T* b, std::size_t n) {
+        V acc{};
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc += *At(a + i) * *At(b + i);
+        }
+        T res = Scalar<T>::Dot(a + i, b + i, n - i);
+        for(std::size_t j = 0; j < kLanes; j++) res += acc[j];
+        return res;
+    }
+};
+
+template<typename T>
+struct Sse2{
+    using P = Packed<T, 16>;
+    __attribute__((target("sse2"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("sse2"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("sse2"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("sse2"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("sse2"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("sse2"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("sse2"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+template<typename T>
+struct Avx2{
+    using P = Packed<T, 32>;
+    __attribute__((target("avx2"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("avx2"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("avx2"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("avx2"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("avx2"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("avx2"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("avx2"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+template<typename T>
+struct Avx512{
+    using P = Packed<T, 64>;
+    __attribute__((target("avx512f,avx512bw"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+
+enum class Isa{ kScalar, kSse2, kAvx2, kAvx512 };
+inline Isa DetectIsa() {
+    static const Isa isa = [] {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::kAvx512;
+        if(__builtin_cpu_supports("avx2")) return Isa::kAvx2;
+        if(__builtin_cpu_supports("sse2")) return Isa::kSse2;
+        return Isa::kScalar;
+    }();
+    return isa;
+}
+#endif
+
+// * 是否正在編譯期求值：編譯期只能使用Scalar<T>的純迴圈(vector extension與CPUID都不是constexpr)。
+constexpr bool InConstantEvaluation() {
+#if __cplusplus > 201703L
+    return std::is_constant_evaluated();
+#else
+    return __builtin_is_constant_evaluated();
+#endif
+}
+
+// * 以kernel(Scalar<T>、Sse2<T>、...其中之一)的型別呼叫f，讓每個操作只需寫一次分派。
+template<typename T, typename F>
+decltype(auto) Dispatch(F&& f) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if constexpr(kVectorizable<T>) {
+        switch(DetectIsa()) {
+            case Isa::kAvx512: return f(Avx512<T>{});
+            case Isa::kAvx2:   return f(Avx2<T>{});
+            case Isa::kSse2:   return f(Sse2<T>{});
+            case Isa::kScalar: break;
+        }
+    }
+#endif
+    return f(Scalar<T>{});
+}
+template<typename T>
+constexpr void Fill(T* p, std::size_t n, const T& val) {
+    if(InConstantEvaluation()) return Scalar<T>::Fill(p, n, val);
+    Dispatch<T>([&](auto kernel) { decltype(kernel)::Fill(p, n, val); });
+}
+template<typename T>
+constexpr std::size_t Find(const T* p, std::size_t n, const T& val) {
+    if(InConstantEvaluation()) return Scalar<T>::Find(p, n, val);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Find(p, n, val); });
+}
+template<typename T>
+constexpr std::size_t Count(const T* p, std::size_t n, const T& val) {
+    if(InConstantEvaluation()) return Scalar<T>::Count(p, n, val);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Count(p, n, val); });
+}
+template<typename T>
+constexpr T Min(const T* p, std::size_t n) {
+    if(InConstantEvaluation()) return Scalar<T>::Min(p, n);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Min(p, n); });
+}
+template<typename T>
+constexpr T Max(const T* p, std::size_t n) {
+    if(InConstantEvaluation()) return Scalar<T>::Max(p, n);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Max(p, n); });
+}
+template<typename T>
+constexpr T Sum(const T* p, std::size_t n) {
+    if(InConstantEvaluation()) return Scalar<T>::Sum(p, n);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Sum(p, n); });
+}
+template<typename T>
+constexpr T Dot(const T* a, const T* b, std::size_t n) {
+    if(InConstantEvaluation()) return Scalar<T>::Dot(a, b, n);
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Dot(a, b, n); });
+}
+}
+
+// * ContiguousIterator: 與Custom_Vector.cpp相同的連續隨機存取迭代器，T為const時就是ConstIterator；
+//   讓std::sort、std::lower_bound等標準演算法可以直接作用在Array上。
+template<typename T>
+class ContiguousIterator{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    ContiguousIterator() = default;
+    constexpr ContiguousIterator(T* ptr): ptr_(ptr) {}
+    // * Iterator可以隱式轉成ConstIterator，反之則不行。
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_const_v<U>>>
+    constexpr ContiguousIterator(const ContiguousIterator<U>& other): ptr_(other.Get()) {}
+    constexpr T* Get() const {
+        return ptr_;
+    }
+    constexpr T& operator*() const {
+        return *ptr_;
+    }
+    constexpr T* operator->() const {
+        return ptr_;
+    }
+    constexpr T& operator[](difference_type n) const {
+        return ptr_[n];
+    }
+    constexpr ContiguousIterator& operator++() {
+        ++ptr_;
         return *this;
     }
-    Array(Array&& other) {
-        for(int i = 0; i < N; i++) {
-            arr[i] = std::move(other.arr[i]);
+    constexpr ContiguousIterator operator++(int) {
+        return ptr_++;
+    }
+    constexpr ContiguousIterator& operator--() {
+        --ptr_;
+        return *this;
+    }
+    constexpr ContiguousIterator operator--(int) {
+        return ptr_--;
+    }
+    constexpr ContiguousIterator& operator+=(difference_type n) {
+        ptr_ += n;
+        return *this;
+    }
+    constexpr ContiguousIterator& operator-=(difference_type n) {
+        ptr_ -= n;
+        return *this;
+    }
+    friend constexpr ContiguousIterator operator+(ContiguousIterator it, difference_type n) {
+        return it += n;
+    }
+    friend constexpr ContiguousIterator operator+(difference_type n, ContiguousIterator it) {
+        return it += n;
+    }
+    friend constexpr ContiguousIterator operator-(ContiguousIterator it, difference_type n) {
+        return it -= n;
+    }
+    friend constexpr difference_type operator-(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ - b.ptr_;
+    }
+    friend constexpr bool operator==(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ == b.ptr_;
+    }
+    friend constexpr bool operator!=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ != b.ptr_;
+    }
+    friend constexpr bool operator<(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ < b.ptr_;
+    }
+    friend constexpr bool operator>(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ > b.ptr_;
+    }
+    friend constexpr bool operator<=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ <= b.ptr_;
+    }
+    friend constexpr bool operator>=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ >= b.ptr_;
+    }
+  private:
+    T* ptr_{};
+};
+
+// * 運算式樣板(expression templates)：與Custom_Vector.cpp相同，a * 2 + b在賦值給Array時才以單一迴圈計算，
+//   不產生中間的暫存Array。容器以參考保存，運算式只能在同一個完整運算式中使用。
+namespace expr{
+inline constexpr std::size_t kAnySize = static_cast<std::size_t>(-1);
+// * 可以作為運算式葉子的容器(各容器在定義之後特化)。
+template<typename T>
+struct IsTerminal: std::false_type {};
+template<typename E>
+struct Expr{
+    const E& Self() const {
+        return static_cast<const E&>(*this);
+    }
+    // * 轉成容器：Array是沒有建構函式的聚合型別，以此支援Array<double, 4> y = x * 2 + 0.5;的寫法。
+    template<typename C, typename = std::enable_if_t<IsTerminal<C>::value>>
+    operator C() const {
+        C res;
+        res = Self();
+        return res;
+    }
+};
+template<typename T>
+inline constexpr bool kIsOperand = IsTerminal<T>::value || std::is_base_of_v<Expr<T>, T>;
+// * 純量：每個位置都是同一個值，大小配合另一邊。
+template<typename T>
+class Scalar: public Expr<Scalar<T>>{
+  public:
+    explicit Scalar(T val): val_(val) {}
+    T operator[](std::size_t) const {
+        return val_;
+    }
+    std::size_t Size() const {
+        return kAnySize;
+    }
+  private:
+    T val_;
+};
+template<typename T>
+using Wrapped = std::conditional_t<std::is_arithmetic_v<T>, Scalar<T>, T>;
+template<typename T>
+std::conditional_t<std::is_arithmetic_v<T>, Scalar<T>, const T&> Wrap(const T& val) {
+    if constexpr(std::is_arithmetic_v<T>) {
+        return Scalar<T>(val);
+    } else {
+        return val;
+    }
+}
+// * 容器以參考保存，節點(暫存物件)以值保存。
+template<typename T>
+using Stored = std::conditional_t<IsTerminal<T>::value, const T&, T>;
+template<typename T>
+std::size_t SizeOf(const T& e) {
+    return static_cast<std::size_t>(e.Size());
+}
+template<typename Op, typename L, typename R>
+class Binary: public Expr<Binary<Op, L, R>>{
+  public:
+    Binary(const L& l, const R& r): l_(l), r_(r) {
+        if(SizeOf(l_) != kAnySize && SizeOf(r_) != kAnySize && SizeOf(l_) != SizeOf(r_)) {
+            throw std::invalid_argument("Expression Size Mismatch");
         }
     }
-    Array& operator=(Array&& other) {
-        if(&other == this) return *this;
+    auto operator[](std::size_t id) const {
+        return Op()(l_[id], r_[id]);
+    }
+    std::size_t Size() const {
+        return SizeOf(l_) != kAnySize ? SizeOf(l_) : SizeOf(r_);
+    }
+  private:
+    Stored<L> l_;
+    Stored<R> r_;
+};
+template<typename Op, typename E>
+class Unary: public Expr<Unary<Op, E>>{
+  public:
+    explicit Unary(const E& e): e_(e) {}
+    auto operator[](std::size_t id) const {
+        return Op()(e_[id]);
+    }
+    std::size_t Size() const {
+        return SizeOf(e_);
+    }
+  private:
+    Stored<E> e_;
+};
+struct AbsOp{
+    template<typename T>
+    auto operator()(T val) const {
+        using std::abs;
+        return abs(val);
+    }
+};
+// * std::sqrt必須設定errno，迴圈要向量化需以-fno-math-errno編譯。
+struct SqrtOp{
+    template<typename T>
+    auto operator()(T val) const {
+        using std::sqrt;
+        return sqrt(val);
+    }
+};
+// * 至少一邊是容器或運算式，另一邊是容器、運算式或純量時，運算子才會參與多載決議。
+template<typename L, typename R>
+inline constexpr bool kBinaryOperands = (kIsOperand<L> && (kIsOperand<R> || std::is_arithmetic_v<R>)) ||
+                                        (std::is_arithmetic_v<L> && kIsOperand<R>);
+template<typename Op, typename L, typename R>
+Binary<Op, Wrapped<L>, Wrapped<R>> MakeBinary(const L& l, const R& r) {
+    return {Wrap(l), Wrap(r)};
+}
+}
+
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator+(const L& l, const R& r) {
+    return expr::MakeBinary<std::plus<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator-(const L& l, const R& r) {
+    return expr::MakeBinary<std::minus<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator*(const L& l, const R& r) {
+    return expr::MakeBinary<std::multiplies<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator/(const L& l, const R& r) {
+    return expr::MakeBinary<std::divides<>>(l, r);
+}
+// * 逐元素比較是具名函式而不是運算子，結果是bool的運算式，可以賦值給Vector<bool>當作遮罩。
+//   ==、<等運算子保留給容器本身的比較(整個容器相等、字典序)，std::less、FlatSet<Vector<int>>等才能照常使用。
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Less(const L& l, const R& r) {
+    return expr::MakeBinary<std::less<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Greater(const L& l, const R& r) {
+    return expr::MakeBinary<std::greater<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto LessEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::less_equal<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto GreaterEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::greater_equal<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Equal(const L& l, const R& r) {
+    return expr::MakeBinary<std::equal_to<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto NotEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::not_equal_to<>>(l, r);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto operator-(const E& e) {
+    return expr::Unary<std::negate<>, E>(e);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto Abs(const E& e) {
+    return expr::Unary<expr::AbsOp, E>(e);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto Sqrt(const E& e) {
+    return expr::Unary<expr::SqrtOp, E>(e);
+}
+
+template<typename T, int N>
+class Array{
+    template<typename U, int UN> friend std::ostream& operator<< (std::ostream& os, const Array<U, UN>& Arr);
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = ContiguousIterator<T>;
+    using const_iterator = ContiguousIterator<const T>;
+    // * Array是聚合型別(aggregate)：沒有任何自訂的建構函式，複製、移動與解構全部由編譯器產生。
+    //   元素是算術型別時Array因此是trivially copyable，可以直接memcpy(例如Vector<Array<int, 8>>重新配置時整塊複製)，
+    //   也可以放在暫存器中傳遞。Array<int, 3> a {1, 2, 3}是聚合初始化，初值超過N個時是編譯錯誤，不足N個時其餘元素為值初始化。
+    // * 運算式樣板賦值，以單一迴圈計算；運算式的大小必須剛好是N(建構則經由運算式的轉換運算子)。
+    template<typename E>
+    Array& operator=(const expr::Expr<E>& e) {
+        Assign(e.Self());
+        return *this;
+    }
+    // * 以f(0), f(1), ..., f(N-1)產生每個元素。在constexpr變數的初始化中呼叫時整張表由編譯器算好，
+    //   直接放在唯讀資料區段(.rodata)，執行時不需要任何初始化，例如CRC表或位元反轉表。
+    template<typename F>
+    static constexpr Array Generate(F&& f) {
+        Array res{};
         for(int i = 0; i < N; i++) {
-            arr[i] = std::move(other.arr[i]);
+            res.arr[i] = f(static_cast<std::size_t>(i));
         }
-        return *this;
+        return res;
     }
-    ~Array() = default;
-    T& operator[] (int id) {
+    constexpr T& operator[] (int id) {
         return arr[id];
     }
-    const T& operator[] (int id) const {
+    constexpr const T& operator[] (int id) const {
         return arr[id];
     }
-    T& At(int id) {
+    constexpr T& At(int id) {
         if(id >= N) throw std::out_of_range("Array Index Out of Bound");
         return arr[id];
     }
-    const T& At(int id) const {
+    constexpr const T& At(int id) const {
         if(id >= N) throw std::out_of_range("Array Index Out of Bound");
         return arr[id];
     }
-    T& Front() {
+    constexpr T& Front() {
         return arr[0];
     }
-    T& Back() {
+    constexpr const T& Front() const {
+        return arr[0];
+    }
+    constexpr T& Back() {
         return arr[N-1];
     }
-    void Fill(const T& val) {
-        for(int i = 0; i < N; i++) {
-            arr[i] = val;
-        }
+    constexpr const T& Back() const {
+        return arr[N-1];
     }
-    void Swap(Array& other) {
-        std::swap(other, *this);  // * 因為有實作觸發移動建構以及移動賦值，觸發移動建構以及移動賦值來進行交換。
-
-        /* 用複製來實作交換的版本
-        Array tmp = *this;  // * 透過包裝成Array類別來直接複製類別內部的C風格陣列。
-        *this = other;
-        other = tmp;
-        */
+    constexpr void Fill(const T& val) {
+        simd::Fill(arr, N, val);
+    }
+    // * 回傳第一個等於val的元素索引，找不到時回傳-1。
+    constexpr int Find(const T& val) const {
+        int id = simd::Find<T>(arr, N, val);
+        return id == N ? -1 : id;
+    }
+    constexpr int Count(const T& val) const {
+        return simd::Count<T>(arr, N, val);
+    }
+    constexpr T Min() const {
+        return simd::Min<T>(arr, N);
+    }
+    constexpr T Max() const {
+        return simd::Max<T>(arr, N);
+    }
+    constexpr T Sum() const {
+        return simd::Sum<T>(arr, N);
+    }
+    constexpr T Dot(const Array& other) const {
+        return simd::Dot<T>(arr, other.arr, N);
     }
-    int Size() const {
+    // * 就地逐一交換元素，不像std::swap(a, b)需要一個完整的暫存Array與三次整個陣列的移動。
+    constexpr void Swap(Array& other) {
+        if(simd::InConstantEvaluation()) {  // * std::swap_ranges在C++20之前不是constexpr。
+            for(int i = 0; i < N; i++) {
+                T tmp = std::move(arr[i]);
+                arr[i] = std::move(other.arr[i]);
+                other.arr[i] = std::move(tmp);
+            }
+            return;
+        }
+        std::swap_ranges(arr, arr + N, other.arr);
+    }
+    constexpr int Size() const {
         return N;
     }
-    class Iterator {
-      public:
-        Iterator(T* ptr): ptr_(ptr) {}
-        bool operator!=(const Iterator& other) const {
-            return ptr_ != other.ptr_;
-        }
-        Iterator operator++(int) {
-            return ptr_++;
-        }
-        const T& operator*() const {
-            return *ptr_;
-        }
-      private:
-        T* ptr_;
-    };
-    class ConstIterator {
-      public:
-        ConstIterator(const T* ptr): ptr_(ptr) {}
-        bool operator!=(const ConstIterator& other) const {
-            return ptr_ != other.ptr_;
-        }
-        ConstIterator operator++(int) {
-            return ptr_++;  // * 因為const T* ptr的意思是有一個名字叫ptr(向右沒有東西，在向左碰到*代表指標)的指標(在向左碰到const T)，
-                            //   指向const T，因此ptr指向的T物件不能被更改，但是ptr本身可以指向另一個不能被更動的T物件，因此ptr++是可以的。
-        }
-        const T& operator*() const {
-            return *ptr_;
-        }
-      private:
-        const T* ptr_;
-    };
-    ConstIterator Begin() const {
+    using Iterator = ContiguousIterator<T>;
+    using ConstIterator = ContiguousIterator<const T>;
+    constexpr ConstIterator Begin() const {
         return {&arr[0]};
     }
-    Iterator Begin() {
+    constexpr Iterator Begin() {
         return {&arr[0]};
     }
-    ConstIterator End() const {
+    constexpr ConstIterator End() const {
         return {&arr[N]};
     }
-    Iterator End() {
+    constexpr Iterator End() {
         return {&arr[N]};
     }
+    // * 標準容器介面的名稱，讓range-based for、std::size、std::data以及標準演算法可以直接使用。
+    constexpr T* data() {
+        return arr;
+    }
+    constexpr const T* data() const {
+        return arr;
+    }
+    constexpr std::size_t size() const {
+        return N;
+    }
+    constexpr Iterator begin() {
+        return Begin();
+    }
+    constexpr ConstIterator begin() const {
+        return Begin();
+    }
+    constexpr Iterator end() {
+        return End();
+    }
+    constexpr ConstIterator end() const {
+        return End();
+    }
   private:
-    T arr[N];
+    template<typename E>
+    void Assign(const E& e) {
+        if(e.Size() != static_cast<std::size_t>(N)) throw std::invalid_argument("Expression Size Mismatch");
+        for(int i = 0; i < N; i++) {
+            arr[i] = e[i];
+        }
+    }
+  public:
+    // * 聚合型別的資料成員必須是public(與std::array相同)，使用時請透過operator[]或data()。
+    // * 算術型別且大小是16 bytes的倍數時對齊到16 bytes，fixed::的運算可以整個陣列對齊載入；不要求更大的對齊，
+    //   放在以malloc配置的容器中(只保證16 bytes)時仍然正確。大小不變，因此不影響二進位格式。
+    static constexpr std::size_t kAlign = simd::kVectorizable<T> && N * sizeof(T) % 16 == 0 ? 16 : alignof(T);
+    alignas(kAlign) T arr[N];
 };
+template<typename T, int N>
+struct expr::IsTerminal<Array<T, N>>: std::true_type {};
 template<typename Container>
-const typename Container::ConstIterator Begin(const Container& con) {
+constexpr const typename Container::ConstIterator Begin(const Container& con) {
     return con.Begin();
 }
 template<typename Container>
-typename Container::Iterator Begin(Container& con) {
+constexpr typename Container::Iterator Begin(Container& con) {
     return con.Begin();
 }
 template<typename Container>
-const typename Container::ConstIterator End(const Container& con) {
+constexpr const typename Container::ConstIterator End(const Container& con) {
     return con.End();
 }
 template<typename Container>
-typename Container::Iterator End(Container& con) {
+constexpr typename Container::Iterator End(Container& con) {
     return con.End();
 }
+// * 陣列之間的比較：==逐一比較每個元素，<為字典序，結果是bool；以迴圈實作，C++17的編譯期求值也能使用。
+template<typename T, int N>
+constexpr bool operator==(const Array<T, N>& a, const Array<T, N>& b) {
+    for(int i = 0; i < N; i++) {
+        if(!(a.arr[i] == b.arr[i])) return false;
+    }
+    return true;
+}
+template<typename T, int N>
+constexpr bool operator!=(const Array<T, N>& a, const Array<T, N>& b) {
+    return !(a == b);
+}
+template<typename T, int N>
+constexpr bool operator<(const Array<T, N>& a, const Array<T, N>& b) {
+    for(int i = 0; i < N; i++) {
+        if(a.arr[i] < b.arr[i]) return true;
+        if(b.arr[i] < a.arr[i]) return false;
+    }
+    return false;
+}
+template<typename T, int N>
+constexpr bool operator>(const Array<T, N>& a, const Array<T, N>& b) {
+    return b < a;
+}
+template<typename T, int N>
+constexpr bool operator<=(const Array<T, N>& a, const Array<T, N>& b) {
+    return !(b < a);
+}
+template<typename T, int N>
+constexpr bool operator>=(const Array<T, N>& a, const Array<T, N>& b) {
+    return !(a < b);
+}
 template<typename T, int N>
 std::ostream& operator<< (std::ostream& os, const Array<T, N>& Arr) {
     os << "[";
@@ -150,6 +746,284 @@ std::ostream& operator<< (std::ostream& os, const Array<T, N>& Arr) {
     return os;
 } // (*) Why should this define in the namespace? How std::cout << b call this function? (::operator<<, STD::operator<<)
 
+// * 小型固定大小向量/矩陣的運算(幾何計算中的Array<float, 4>、Array<double, 3>、4x4矩陣Array<float, 16>等)。
+//   這些陣列只有幾個元素，成員函式的執行時SIMD分派與迴圈本身的成本反而比運算還高，因此這裡依N在編譯期完全展開：
+//   N * sizeof(T)剛好是16 bytes(有AVX時也包含32 bytes)時整個陣列以一個vector extension暫存器運算(編譯成SSE/AVX)，
+//   其餘大小(例如double的3維向量)以fold expression展開成沒有迴圈的純量運算。編譯期求值時一律走純量路徑。
+namespace fixed{
+template<typename T, int N>
+inline constexpr bool kPacked =
+#if defined(__GNUC__) && defined(__AVX__)
+    simd::kVectorizable<T> && (N * sizeof(T) == 16 || N * sizeof(T) == 32);
+#elif defined(__GNUC__)
+    simd::kVectorizable<T> && N * sizeof(T) == 16;    // * 沒有AVX時沒有32 bytes的暫存器，交給純量展開(編譯器會合併成兩個SSE運算)。
+#else
+    false;
+#endif
+
+// * 對0, 1, ..., N-1各呼叫一次f(std::integral_constant)，在編譯期展開成N段程式碼；
+//   必須強制inline，否則巢狀展開(MatMul)會留下函式呼叫，暫存器內容也得經過記憶體傳遞。
+#if defined(__GNUC__)
+#define STD_FIXED_INLINE __attribute__((always_inline))
+#else
+#define STD_FIXED_INLINE
+#endif
+template<typename F, std::size_t... I>
+STD_FIXED_INLINE constexpr void Unroll(F&& f, std::index_sequence<I...>) {
+    (f(std::integral_constant<std::size_t, I>{}), ...);
+}
+template<std::size_t N, typename F>
+STD_FIXED_INLINE constexpr void Unroll(F&& f) {
+    Unroll(std::forward<F>(f), std::make_index_sequence<N>{});
+}
+
+#if defined(__GNUC__)
+// * 整個Array對應的暫存器型別；以memcpy載入/存回，編譯後就是一道movaps/movups。
+template<typename T, int N>
+struct Register{
+    typedef T V __attribute__((vector_size(N * sizeof(T))));
+    STD_FIXED_INLINE static V Load(const T* p) {
+        V v;
+        std::memcpy(&v, p, sizeof(V));
+        return v;
+    }
+    STD_FIXED_INLINE static void Store(T* p, const V& v) {
+        std::memcpy(p, &v, sizeof(V));
+    }
+};
+#endif
+
+// * 逐元素的二元運算：op同時接受暫存器與純量(vector extension支援+、-、*以及?:)。
+template<typename T, int N, typename Op>
+constexpr Array<T, N> Elementwise(const Array<T, N>& a, const Array<T, N>& b, Op op) {
+#if defined(__GNUC__)
+    if constexpr(kPacked<T, N>) {
+        if(!simd::InConstantEvaluation()) {
+            using R = Register<T, N>;
+            Array<T, N> res;
+            R::Store(res.data(), op(R::Load(a.data()), R::Load(b.data())));
+            return res;
+        }
+    }
+#endif
+    Array<T, N> res{};
+    Unroll<N>([&](auto i) { res[i] = op(a[i], b[i]); });
+    return res;
+}
+
+template<typename T, int N>
+constexpr Array<T, N> Add(const Array<T, N>& a, const Array<T, N>& b) {
+    return Elementwise(a, b, [](auto x, auto y) { return x + y; });
+}
+template<typename T, int N>
+constexpr Array<T, N> Sub(const Array<T, N>& a, const Array<T, N>& b) {
+    return Elementwise(a, b, [](auto x, auto y) { return x - y; });
+}
+// * 逐元素取較小/較大值(成員函式Min()/Max()則是整個陣列的最小/最大值)。
+template<typename T, int N>
+constexpr Array<T, N> Min(const Array<T, N>& a, const Array<T, N>& b) {
+    return Elementwise(a, b, [](auto x, auto y) { return y < x ? y : x; });
+}
+template<typename T, int N>
+constexpr Array<T, N> Max(const Array<T, N>& a, const Array<T, N>& b) {
+    return Elementwise(a, b, [](auto x, auto y) { return x < y ? y : x; });
+}
+template<typename T, int N>
+constexpr Array<T, N> Scale(const Array<T, N>& a, T s) {
+#if defined(__GNUC__)
+    if constexpr(kPacked<T, N>) {
+        if(!simd::InConstantEvaluation()) {
+            using R = Register<T, N>;
+            Array<T, N> res;
+            R::Store(res.data(), R::Load(a.data()) * s);
+            return res;
+        }
+    }
+#endif
+    Array<T, N> res{};
+    Unroll<N>([&](auto i) { res[i] = a[i] * s; });
+    return res;
+}
+template<typename T, int N>
+constexpr T Dot(const Array<T, N>& a, const Array<T, N>& b) {
+#if defined(__GNUC__)
+    if constexpr(kPacked<T, N>) {
+        if(!simd::InConstantEvaluation()) {
+            using R = Register<T, N>;
+            typename R::V prod = R::Load(a.data()) * R::Load(b.data());
+            T res{};
+            Unroll<N>([&](auto i) { res += prod[i.value]; });
+            return res;
+        }
+    }
+#endif
+    T res{};
+    Unroll<N>([&](auto i) { res += a[i] * b[i]; });
+    return res;
+}
+// * 三維外積；N為4時視為齊次座標(x, y, z, w)，結果的w為0。
+template<typename T, int N>
+constexpr Array<T, N> Cross(const Array<T, N>& a, const Array<T, N>& b) {
+    static_assert(N == 3 || N == 4, "Cross needs a 3D (or homogeneous 4D) vector");
+    Array<T, N> res{};
+    res[0] = a[1] * b[2] - a[2] * b[1];
+    res[1] = a[2] * b[0] - a[0] * b[2];
+    res[2] = a[0] * b[1] - a[1] * b[0];
+    return res;
+}
+// * 以列為主(row-major)的3x3(N = 9)或4x4(N = 16)矩陣乘法a * b。
+//   一列剛好填滿一個暫存器時(float/double的4x4)，結果的第i列 = sum(a[i][k] * b的第k列)，整個乘法只有16次廣播乘加；
+//   否則展開成純量的三層fold expression。
+template<typename T, int N>
+constexpr Array<T, N> MatMul(const Array<T, N>& a, const Array<T, N>& b) {
+    static_assert(N == 9 || N == 16, "MatMul supports 3x3 and 4x4 matrices");
+    constexpr int kDim = N == 9 ? 3 : 4;
+#if defined(__GNUC__)
+    if constexpr(kPacked<T, kDim>) {
+        if(!simd::InConstantEvaluation()) {
+            using R = Register<T, kDim>;
+            typename R::V rows[kDim];
+            Unroll<kDim>([&](auto k) { rows[k] = R::Load(b.data() + k * kDim); });
+            Array<T, N> res;
+            Unroll<kDim>([&](auto i) {
+                typename R::V acc = rows[0] * a[i * kDim];
+                Unroll<kDim - 1>([&](auto k) { acc += rows[k + 1] * a[i * kDim + k + 1]; });
+                R::Store(res.data() + i * kDim, acc);
+            });
+            return res;
+        }
+    }
+#endif
+    Array<T, N> res{};
+    Unroll<kDim>([&](auto i) {
+        Unroll<kDim>([&](auto j) {
+            T sum{};
+            Unroll<kDim>([&](auto k) { sum += a[i * kDim + k] * b[k * kDim + j]; });
+            res[i * kDim + j] = sum;
+        });
+    });
+    return res;
+}
+#undef STD_FIXED_INLINE
+}
+
+// * 二進位序列化格式(version 1)：與Custom_Vector.cpp的SaveBinary/LoadBinary完全相同，兩邊寫出的檔案可以互相讀取。
+//   64 bytes的標頭(型別標記、元素大小、對齊、個數、位元組順序、checksum)後面緊接著元素的原始位元組。
+namespace binary{
+// * 型別標記：算術型別各有固定編號，其他trivially copyable的使用者型別為0(只檢查元素大小與對齊)。
+template<typename T> struct TypeTag: std::integral_constant<std::uint16_t, 0> {};
+template<> struct TypeTag<std::int8_t>: std::integral_constant<std::uint16_t, 1> {};
+template<> struct TypeTag<std::uint8_t>: std::integral_constant<std::uint16_t, 2> {};
+template<> struct TypeTag<std::int16_t>: std::integral_constant<std::uint16_t, 3> {};
+template<> struct TypeTag<std::uint16_t>: std::integral_constant<std::uint16_t, 4> {};
+template<> struct TypeTag<std::int32_t>: std::integral_constant<std::uint16_t, 5> {};
+template<> struct TypeTag<std::uint32_t>: std::integral_constant<std::uint16_t, 6> {};
+template<> struct TypeTag<std::int64_t>: std::integral_constant<std::uint16_t, 7> {};
+template<> struct TypeTag<std::uint64_t>: std::integral_constant<std::uint16_t, 8> {};
+template<> struct TypeTag<float>: std::integral_constant<std::uint16_t, 9> {};
+template<> struct TypeTag<double>: std::integral_constant<std::uint16_t, 10> {};
+template<> struct TypeTag<char>: std::integral_constant<std::uint16_t, 11> {};
+template<> struct TypeTag<bool>: std::integral_constant<std::uint16_t, 12> {};
+
+struct Header{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t byte_order;                   // * 寫入端的0x0102；讀到0x0201代表位元組順序不同。
+    std::uint16_t type_tag;
+    std::uint16_t reserved;
+    std::uint32_t elem_size;
+    std::uint32_t alignment;
+    std::uint32_t header_size;
+    std::uint64_t count;
+    std::uint64_t checksum;
+    char padding[24];
+};
+static_assert(sizeof(Header) == 64, "binary header must stay 64 bytes");
+inline constexpr char kMagic[4] = {'S', 'T', 'D', 'B'};
+inline constexpr std::uint16_t kVersion = 1;
+inline constexpr std::uint16_t kByteOrder = 0x0102;
+
+// * 64-bit checksum：一次處理8 bytes，以四條獨立的累加鏈讓CPU平行運算，速度遠高於逐位元組的FNV-1a。
+inline std::uint64_t Checksum(const void* data, std::size_t bytes) {
+    constexpr std::uint64_t kPrime = 0x100000001b3ULL;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::uint64_t h[4] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL, 0x9ce484222325cbf2ULL, 0x2325cbf29ce48422ULL};
+    std::size_t i = 0;
+    for(; i + 32 <= bytes; i += 32) {
+        for(int k = 0; k < 4; k++) {
+            std::uint64_t w;
+            std::memcpy(&w, p + i + 8 * k, 8);
+            h[k] = (h[k] ^ w) * kPrime;
+            h[k] ^= h[k] >> 29;
+        }
+    }
+    std::uint64_t res = h[0] ^ (h[1] * 3) ^ (h[2] * 5) ^ (h[3] * 7);
+    for(; i < bytes; i++) {
+        res = (res ^ p[i]) * kPrime;
+    }
+    return (res ^ bytes) * kPrime;
+}
+template<typename T>
+Header MakeHeader(const T* data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary format stores elements as raw bytes");
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrder;
+    header.type_tag = TypeTag<T>::value;
+    header.elem_size = sizeof(T);
+    header.alignment = alignof(T);
+    header.header_size = sizeof(Header);
+    header.count = count;
+    header.checksum = Checksum(data, count * sizeof(T));
+    return header;
+}
+template<typename T>
+void CheckHeader(const Header& header) {
+    if(std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) throw std::runtime_error("Binary Format Error: bad magic");
+    if(header.version != kVersion) throw std::runtime_error("Binary Format Error: unsupported version");
+    if(header.byte_order != kByteOrder) throw std::runtime_error("Binary Format Error: byte order mismatch");
+    if(header.header_size != sizeof(Header)) throw std::runtime_error("Binary Format Error: unsupported header size");
+    if(header.type_tag != TypeTag<T>::value || header.elem_size != sizeof(T) || header.alignment != alignof(T)) {
+        throw std::runtime_error("Binary Format Error: element type mismatch");
+    }
+}
+template<typename T>
+void WriteBinary(const T* data, std::size_t count, std::ostream& os) {
+    Header header = MakeHeader(data, count);
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    if(!os) throw std::runtime_error("Binary Format Error: write failed");
+}
+inline Header ReadHeader(std::istream& is) {
+    Header header;
+    if(!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Binary Format Error: truncated header");
+    }
+    return header;
+}
+}
+
+template<typename T, int N>
+void SaveBinary(const Array<T, N>& arr, std::ostream& os) {
+    binary::WriteBinary(N ? &arr[0] : nullptr, N, os);
+}
+// * 元素個數必須剛好是N，Array的大小是型別的一部分，不能像Vector一樣隨資料調整。
+template<typename T, int N>
+Array<T, N> LoadBinary(std::istream& is) {
+    binary::Header header = binary::ReadHeader(is);
+    binary::CheckHeader<T>(header);
+    if(header.count != static_cast<std::uint64_t>(N)) throw std::runtime_error("Binary Format Error: element count mismatch");
+    Array<T, N> arr;
+    if(N && !is.read(reinterpret_cast<char*>(&arr[0]), N * sizeof(T))) {
+        throw std::runtime_error("Binary Format Error: truncated payload");
+    }
+    if(binary::Checksum(N ? &arr[0] : nullptr, N * sizeof(T)) != header.checksum) {
+        throw std::runtime_error("Binary Format Error: checksum mismatch");
+    }
+    return arr;
+}
+
 }
 
 int main() {
@@ -196,5 +1070,103 @@ int main() {
     }
     std::cout << std::endl;
 
+    STD::Array<int, 20> f;
+    f.Fill(2);                                                 // * 以機器支援的最寬SIMD指令執行。
+    f[13] = -7;
+    std::cout << f.Find(-7) << " " << f.Count(2) << std::endl; // 13 19
+    std::cout << f.Min() << " " << f.Max() << std::endl;       // -7 2
+    std::cout << f.Sum() << " " << f.Dot(f) << std::endl;      // 31 125
+
+    std::stringstream ss;
+    STD::SaveBinary(f, ss);
+    STD::Array<int, 20> g = STD::LoadBinary<int, 20>(ss);
+    std::cout << g.Find(-7) << " " << g.Sum() << std::endl;    // 13 31
+    std::cout << (g == f) << (a < b) << std::endl;             // 11
+    try {
+        std::stringstream again(ss.str());
+        STD::LoadBinary<int, 10>(again);
+    } catch(const std::runtime_error& e) {
+        std::cout << e.what() << std::endl;                    // Binary Format Error: element count mismatch
+    }
+
+    STD::Array<int, 6> h {42, 7, 19, 3, 88, 7};
+    std::sort(h.begin(), h.end());                             // * 迭代器是隨機存取的，標準演算法可以直接使用。
+    std::cout << h << std::endl;                               // [3, 7, 7, 19, 42, 88]
+    std::cout << std::lower_bound(h.begin(), h.end(), 19) - h.begin() << " " << std::size(h) << std::endl; // 3 6
+
+    STD::Array<double, 4> x {1, -4, 9, -16};
+    STD::Array<double, 4> y = x * 2 + 0.5;                     // * 單一迴圈計算，沒有x * 2的暫存Array。
+    std::cout << y << std::endl;                               // [2.5, -7.5, 18.5, -31.5]
+    y = STD::Sqrt(STD::Abs(x)) - y / y;
+    std::cout << y << std::endl;                               // [0, 1, 2, 3]
+
+    // * 整張CRC-32表與位元反轉表都在編譯期算好(static_assert可以直接檢查)，執行時沒有任何初始化成本。
+    static constexpr auto crc_table = STD::Array<std::uint32_t, 256>::Generate([](std::size_t i) {
+        std::uint32_t crc = static_cast<std::uint32_t>(i);
+        for(int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0);
+        }
+        return crc;
+    });
+    static_assert(crc_table[1] == 0x77073096u && crc_table[255] == 0x2D02EF8Du);
+    constexpr auto bit_reverse = STD::Array<std::uint8_t, 256>::Generate([](std::size_t i) {
+        std::uint8_t res = 0;
+        for(int k = 0; k < 8; k++) {
+            res |= ((i >> k) & 1) << (7 - k);
+        }
+        return res;
+    });
+    static_assert(bit_reverse[0x01] == 0x80 && bit_reverse[0xB4] == 0x2D);
+    constexpr STD::Array<int, 4> seeds = [] {
+        STD::Array<int, 4> res {4, 1, 3};
+        STD::Array<int, 4> other{};                            // * 編譯期的物件必須初始化，因此以{}建構。
+        other.Fill(9);
+        res.Swap(other);
+        res.At(3) = res.Sum() - other.Max();                   // * Fill、Swap、At、Sum都可以在編譯期執行。
+        return res;
+    }();
+    static_assert(seeds.Back() == 32 && seeds.Find(32) == 3);
+    std::uint32_t crc = 0xFFFFFFFFu;
+    for(char c: std::string("123456789")) {
+        crc = crc_table[(crc ^ static_cast<unsigned char>(c)) & 0xFF] ^ (crc >> 8);
+    }
+    std::cout << std::hex << (crc ^ 0xFFFFFFFFu) << std::dec << " " << seeds << std::endl; // cbf43926 [9, 9, 9, 32]
+
+    // * 幾何計算用的小型向量與矩陣：依N在編譯期展開，float的4維向量整個放在一個SSE暫存器中運算。
+    STD::Array<float, 4> p {1, 2, 3, 1};
+    STD::Array<float, 4> q {0.5f, -1, 4, 0};
+    static_assert(alignof(STD::Array<float, 4>) == 16 && sizeof(STD::Array<double, 3>) == 24);
+    std::cout << STD::fixed::Add(p, q) << " " << STD::fixed::Scale(q, 2.0f) << " " << STD::fixed::Dot(p, q) << std::endl; // [1.5, 1, 7, 1] [1, -2, 8, 0] 10.5
+    std::cout << STD::fixed::Min(p, q) << " " << STD::fixed::Max(p, q) << std::endl;   // [0.5, -1, 3, 0] [1, 2, 4, 1]
+    constexpr STD::Array<double, 3> ex {1, 0, 0};
+    constexpr STD::Array<double, 3> ey {0, 1, 0};
+    constexpr STD::Array<double, 3> ez = STD::fixed::Cross(ex, ey);                    // * 編譯期也可以使用。
+    static_assert(ez[2] == 1 && STD::fixed::Dot(ez, ex) == 0);
+    std::cout << ez << " " << STD::fixed::Sub(ex, ey) << std::endl;                    // [0, 0, 1] [1, -1, 0]
+    STD::Array<float, 16> translate {1, 0, 0, 5,
+                                     0, 1, 0, 6,
+                                     0, 0, 1, 7,
+                                     0, 0, 0, 1};
+    STD::Array<float, 16> scale {2, 0, 0, 0,
+                                 0, 2, 0, 0,
+                                 0, 0, 2, 0,
+                                 0, 0, 0, 1};
+    std::cout << STD::fixed::MatMul(translate, scale) << std::endl; // [2, 0, 0, 5, 0, 2, 0, 6, 0, 0, 2, 7, 0, 0, 0, 1]
+    constexpr STD::Array<int, 9> rot {0, -1, 0,
+                                      1, 0, 0,
+                                      0, 0, 1};
+    constexpr STD::Array<int, 9> half_turn = STD::fixed::MatMul(rot, rot);
+    std::cout << half_turn << std::endl;                                               // [-1, 0, 0, 0, -1, 0, 0, 0, 1]
+
+    // * 聚合型別：複製就是memcpy，交換是就地逐一交換，初值個數在編譯期檢查(STD::Array<int, 2> {1, 2, 3}無法編譯)。
+    static_assert(std::is_aggregate_v<STD::Array<std::string, 2>> && std::is_trivially_copyable_v<STD::Array<int, 8>>);
+    STD::Array<int, 8> packet {1, 2, 3, 4};
+    STD::Array<int, 8> raw;
+    std::memcpy(&raw, &packet, sizeof(packet));
+    STD::Array<std::string, 2> names {"left", "right"};
+    STD::Array<std::string, 2> others {"up"};
+    names.Swap(others);
+    std::cout << raw << " " << names << " " << others << std::endl; // [1, 2, 3, 4, 0, 0, 0, 0] [up, ] [left, right]
+
     return 0;
 }
\ No newline at end of file
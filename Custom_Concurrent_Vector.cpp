@@ -0,0 +1,175 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <utility>
+#include <cstddef>
+namespace STD{
+// * ConcurrentVector: 可以由多個執行緒同時PushBack的只增(append-only)容器，不需要任何mutex。
+//   元素放在一連串大小為2的冪次的segment中(kBase、2*kBase、4*kBase...)，容量不足時只配置下一個segment，
+//   既有的元素永遠不會被搬移，因此取得的參考與指標在容器解構之前一直有效。
+//   PushBack以atomic的fetch_add取得自己的索引，segment的配置以compare_exchange決定由誰安裝(輸的一方釋放自己配置的)。
+//   每個位置另有一個ready旗標，元素建構完成後才以release設為true；其他執行緒可以一邊讀取一邊有人在新增，
+//   只要先以Ready(id)(acquire)確認該位置已經建構完成即可。
+template<typename T>
+class ConcurrentVector{
+    static constexpr std::size_t kBaseLog = 5;
+    static constexpr std::size_t kBase = std::size_t{1} << kBaseLog;
+    static constexpr std::size_t kSegments = std::numeric_limits<std::size_t>::digits - kBaseLog;
+  public:
+    ConcurrentVector() = default;
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+    ~ConcurrentVector() {
+        std::size_t n = size_.load(std::memory_order_acquire);
+        for(std::size_t k = 0; k < kSegments; k++) {
+            char* segment = segments_[k].load(std::memory_order_acquire);
+            if(!segment) continue;
+            for(std::size_t i = 0; i < SegmentSize(k) && SegmentStart(k) + i < n; i++) {
+                if(Flags(segment, k)[i].load(std::memory_order_relaxed)) Elements(segment)[i].~T();
+            }
+            ::operator delete(segment, std::align_val_t(alignof(T)));
+        }
+    }
+    // * 新增一個元素並回傳它的索引；可以從任意多個執行緒同時呼叫。
+    std::size_t PushBack(const T& val) {
+        return EmplaceBack(val);
+    }
+    std::size_t PushBack(T&& val) {
+        return EmplaceBack(std::move(val));
+    }
+    // * 建構途中拋出例外時，該索引的位置永遠不會變成ready(之後的元素不受影響)。
+    template<typename... Args>
+    std::size_t EmplaceBack(Args&&... args) {
+        std::size_t id = size_.fetch_add(1, std::memory_order_relaxed);
+        std::size_t k = SegmentOf(id);
+        char* segment = EnsureSegment(k);
+        std::size_t offset = id - SegmentStart(k);
+        new (Elements(segment) + offset) T(std::forward<Args>(args)...);
+        Flags(segment, k)[offset].store(true, std::memory_order_release);
+        return id;
+    }
+    // * 事先配置足以容納n個元素的segment。
+    void Reserve(std::size_t n) {
+        for(std::size_t k = 0; k < kSegments && SegmentStart(k) < n; k++) {
+            EnsureSegment(k);
+        }
+    }
+    // * 已經被PushBack取走的位置數(其中可能有元素還在建構中)。
+    std::size_t Size() const {
+        return size_.load(std::memory_order_acquire);
+    }
+    bool Empty() const {
+        return Size() == 0;
+    }
+    // * 位置id上的元素是否已經建構完成；為true之後就可以從任何執行緒讀取operator[](id)。
+    bool Ready(std::size_t id) const {
+        if(id >= Size()) return false;
+        std::size_t k = SegmentOf(id);
+        char* segment = segments_[k].load(std::memory_order_acquire);
+        return segment && Flags(segment, k)[id - SegmentStart(k)].load(std::memory_order_acquire);
+    }
+    // * 呼叫端必須確定元素已經建構完成：PushBack的回傳值、Ready(id)為true，或所有寫入的執行緒都已經join。
+    T& operator[](std::size_t id) {
+        std::size_t k = SegmentOf(id);
+        return Elements(segments_[k].load(std::memory_order_acquire))[id - SegmentStart(k)];
+    }
+    const T& operator[](std::size_t id) const {
+        std::size_t k = SegmentOf(id);
+        return Elements(segments_[k].load(std::memory_order_acquire))[id - SegmentStart(k)];
+    }
+    // * 依索引順序對目前已經建構完成的元素呼叫f，可以與PushBack同時進行。
+    template<typename F>
+    void ForEach(F&& f) const {
+        std::size_t n = Size();
+        for(std::size_t id = 0; id < n; id++) {
+            if(Ready(id)) f((*this)[id]);
+        }
+    }
+  private:
+    // * 索引id加上kBase之後，最高位元的位置就決定了它落在哪個segment。
+    static std::size_t SegmentOf(std::size_t id) {
+        return (std::numeric_limits<unsigned long long>::digits - 1 - __builtin_clzll(id + kBase)) - kBaseLog;
+    }
+    static std::size_t SegmentStart(std::size_t k) {
+        return (kBase << k) - kBase;
+    }
+    static std::size_t SegmentSize(std::size_t k) {
+        return kBase << k;
+    }
+    // * 一個segment是一整塊記憶體：前段放SegmentSize(k)個元素，後段放同樣個數的ready旗標。
+    static T* Elements(char* segment) {
+        return reinterpret_cast<T*>(segment);
+    }
+    static std::atomic<bool>* Flags(char* segment, std::size_t k) {
+        return reinterpret_cast<std::atomic<bool>*>(segment + sizeof(T) * SegmentSize(k));
+    }
+    char* EnsureSegment(std::size_t k) {
+        char* segment = segments_[k].load(std::memory_order_acquire);
+        if(segment) return segment;
+        std::size_t n = SegmentSize(k);
+        char* fresh = static_cast<char*>(::operator new(sizeof(T) * n + sizeof(std::atomic<bool>) * n, std::align_val_t(alignof(T))));
+        for(std::size_t i = 0; i < n; i++) {
+            new (Flags(fresh, k) + i) std::atomic<bool>(false);
+        }
+        if(segments_[k].compare_exchange_strong(segment, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            return fresh;
+        }
+        ::operator delete(fresh, std::align_val_t(alignof(T))); // * 其他執行緒已經裝好這個segment。
+        return segment;
+    }
+    std::atomic<char*> segments_[kSegments]{};
+    std::atomic<std::size_t> size_{0};
+};
+
+template<typename T>
+std::ostream& operator<<(std::ostream& os, const ConcurrentVector<T>& vec) {
+    os << "[";
+    bool first = true;
+    vec.ForEach([&](const T& val) {
+        if(!first) os << ", ";
+        os << val;
+        first = false;
+    });
+    os << "]";
+    return os;
+}
+}
+
+int main() {
+    STD::ConcurrentVector<int> results;
+    results.PushBack(-1);
+    const int* first = &results[0];
+    std::vector<std::thread> collectors;
+    for(int t = 0; t < 4; t++) {
+        collectors.emplace_back([&results, t] {
+            for(int i = 0; i < 1000; i++) {
+                results.PushBack(t * 1000 + i);    // * 沒有mutex，四個執行緒同時新增。
+            }
+        });
+    }
+    long long seen = 0;
+    while(seen < 4001) {                           // * 讀取的同時其他執行緒還在新增。
+        seen = 0;
+        results.ForEach([&seen](int) { seen++; });
+    }
+    for(std::thread& collector: collectors) {
+        collector.join();
+    }
+    long long sum = 0;
+    results.ForEach([&sum](int val) { sum += val; });
+    std::cout << results.Size() << " " << sum << std::endl;      // 4001 7997999
+    std::cout << (first == &results[0]) << std::endl;            // 1 (元素從未被搬移)
+
+    STD::ConcurrentVector<std::string> words;
+    words.Reserve(100);
+    std::size_t id = words.EmplaceBack(3, 'z');
+    words.PushBack("segment");
+    std::cout << words[id] << " " << words.Ready(1) << " " << words.Ready(2) << std::endl; // zzz 1 0
+    std::cout << words << std::endl;                             // [zzz, segment]
+    return 0;
+}
\ No newline at end of file
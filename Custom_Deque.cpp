@@ -0,0 +1,357 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+namespace STD{
+// * Deque: 由固定大小的區塊(block)加上一個記錄區塊指標的map組成，介於Array與List之間的雙端佇列。
+//   元素在區塊內連續存放(對cache友善，不像List每個元素一個heap節點)，map滿了只需要搬移區塊指標，
+//   元素本身永遠不會被搬移，因此PushBack/PushFront之後既有元素的參考與指標仍然有效(不像Vector會重新配置)。
+//   兩端的新增與刪除都是O(1)，索引存取也是O(1)：第i個元素位於區塊(start_+i)/kBlock中的第(start_+i)%kBlock格。
+//   當作佇列使用(尾端新增、前端刪除)時，前端空出來的區塊會在map重新置中時輪轉到尾端重複使用，記憶體不會一直增加。
+template<typename T>
+class Deque{
+    template<typename U> friend std::ostream& operator<<(std::ostream& os, const Deque<U>& deq);
+    // * 每個區塊約4 KiB，至少16個元素。
+    static constexpr std::size_t kBlock = std::max<std::size_t>(16, 4096 / sizeof(T));
+    static constexpr std::size_t kMinMap = 8;
+  public:
+    Deque() = default;
+    Deque(std::size_t size) {
+        for(std::size_t i = 0; i < size; i++) {
+            EmplaceBack();
+        }
+    }
+    Deque(const std::initializer_list<T> lst) {
+        for(const T& val: lst) {
+            PushBack(val);
+        }
+    }
+    Deque(const Deque& other) {
+        for(std::size_t i = 0; i < other.size_; i++) {
+            PushBack(other[i]);
+        }
+    }
+    Deque& operator=(const Deque& other) {
+        if(&other == this) return *this;
+        Deque tmp = other;
+        Swap(tmp);
+        return *this;
+    }
+    Deque(Deque&& other) noexcept {
+        Swap(other);
+    }
+    Deque& operator=(Deque&& other) noexcept {
+        if(&other == this) return *this;
+        Deque tmp = std::move(other);
+        Swap(tmp);
+        return *this;
+    }
+    ~Deque() {
+        Clear();
+        for(std::size_t b = 0; b < map_size_; b++) {
+            if(map_[b]) std::allocator<T>().deallocate(map_[b], kBlock);
+        }
+        if(map_) std::allocator<T*>().deallocate(map_, map_size_);
+    }
+    T& operator[](std::size_t id) {
+        return *Slot(start_ + id);
+    }
+    const T& operator[](std::size_t id) const {
+        return *Slot(start_ + id);
+    }
+    T& At(std::size_t id) {
+        if(id >= size_) throw std::out_of_range("Deque Index Out of Bound");
+        return (*this)[id];
+    }
+    const T& At(std::size_t id) const {
+        if(id >= size_) throw std::out_of_range("Deque Index Out of Bound");
+        return (*this)[id];
+    }
+    T& Front() {
+        return (*this)[0];
+    }
+    const T& Front() const {
+        return (*this)[0];
+    }
+    T& Back() {
+        return (*this)[size_-1];
+    }
+    const T& Back() const {
+        return (*this)[size_-1];
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    void PushBack(const T& val) {
+        EmplaceBack(val);
+    }
+    void PushBack(T&& val) {
+        EmplaceBack(std::move(val));
+    }
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if(start_ + size_ == map_size_ * kBlock) Recenter();
+        T* slot = EnsureSlot(start_ + size_);
+        new (slot) T(std::forward<Args>(args)...);
+        size_++;
+        return *slot;
+    }
+    void PushFront(const T& val) {
+        EmplaceFront(val);
+    }
+    void PushFront(T&& val) {
+        EmplaceFront(std::move(val));
+    }
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args) {
+        if(start_ == 0) Recenter();
+        T* slot = EnsureSlot(start_ - 1);
+        new (slot) T(std::forward<Args>(args)...);
+        start_--;
+        size_++;
+        return *slot;
+    }
+    void PopBack() {
+        if(!Empty()) {
+            Back().~T();
+            size_--;
+        }
+    }
+    void PopFront() {
+        if(!Empty()) {
+            Front().~T();
+            start_++;
+            size_--;
+        }
+    }
+    void Clear() {
+        while(!Empty()) {
+            PopBack();
+        }
+    }
+    // * 釋放目前沒有存放任何元素的區塊。
+    void ShrinkToFit() {
+        std::size_t first = start_ / kBlock;
+        std::size_t last = size_ ? (start_ + size_ - 1) / kBlock : first;
+        for(std::size_t b = 0; b < map_size_; b++) {
+            if(map_[b] && (size_ == 0 || b < first || b > last)) {
+                std::allocator<T>().deallocate(map_[b], kBlock);
+                map_[b] = nullptr;
+            }
+        }
+    }
+    void Swap(Deque& other) {
+        std::swap(other.map_, map_);
+        std::swap(other.map_size_, map_size_);
+        std::swap(other.start_, start_);
+        std::swap(other.size_, size_);
+    }
+    // * 以索引表示位置的隨機存取迭代器；跨區塊時不必特別處理，解參考時才換算成(區塊, 格)。
+    template<bool Const>
+    class BasicIterator{
+        using Owner = std::conditional_t<Const, const Deque, Deque>;
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+        BasicIterator() = default;
+        BasicIterator(Owner* deq, std::size_t id): deq_(deq), id_(id) {}
+        operator BasicIterator<true>() const {
+            return {deq_, id_};
+        }
+        reference operator*() const {
+            return (*deq_)[id_];
+        }
+        pointer operator->() const {
+            return &(*deq_)[id_];
+        }
+        reference operator[](difference_type n) const {
+            return (*deq_)[id_ + n];
+        }
+        BasicIterator& operator++() {
+            ++id_;
+            return *this;
+        }
+        BasicIterator operator++(int) {
+            return {deq_, id_++};
+        }
+        BasicIterator& operator--() {
+            --id_;
+            return *this;
+        }
+        BasicIterator operator--(int) {
+            return {deq_, id_--};
+        }
+        BasicIterator& operator+=(difference_type n) {
+            id_ += n;
+            return *this;
+        }
+        BasicIterator& operator-=(difference_type n) {
+            id_ -= n;
+            return *this;
+        }
+        friend BasicIterator operator+(BasicIterator it, difference_type n) {
+            return it += n;
+        }
+        friend BasicIterator operator+(difference_type n, BasicIterator it) {
+            return it += n;
+        }
+        friend BasicIterator operator-(BasicIterator it, difference_type n) {
+            return it -= n;
+        }
+        friend difference_type operator-(const BasicIterator& a, const BasicIterator& b) {
+            return static_cast<difference_type>(a.id_) - static_cast<difference_type>(b.id_);
+        }
+        friend bool operator==(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ == b.id_;
+        }
+        friend bool operator!=(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ != b.id_;
+        }
+        friend bool operator<(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ < b.id_;
+        }
+        friend bool operator>(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ > b.id_;
+        }
+        friend bool operator<=(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ <= b.id_;
+        }
+        friend bool operator>=(const BasicIterator& a, const BasicIterator& b) {
+            return a.id_ >= b.id_;
+        }
+      private:
+        Owner* deq_{};
+        std::size_t id_{};
+    };
+    using Iterator = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+    Iterator Begin() {
+        return {this, 0};
+    }
+    ConstIterator Begin() const {
+        return {this, 0};
+    }
+    Iterator End() {
+        return {this, size_};
+    }
+    ConstIterator End() const {
+        return {this, size_};
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    Iterator begin() {
+        return Begin();
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    Iterator end() {
+        return End();
+    }
+    ConstIterator end() const {
+        return End();
+    }
+  private:
+    T* Slot(std::size_t pos) const {
+        return map_[pos / kBlock] + pos % kBlock;
+    }
+    // * 位置pos所在的區塊還沒配置時才配置(之前釋放或從未使用過的區塊)。
+    T* EnsureSlot(std::size_t pos) {
+        T*& block = map_[pos / kBlock];
+        if(!block) block = std::allocator<T>().allocate(kBlock);
+        return block + pos % kBlock;
+    }
+    // * 某一端沒有空位時呼叫：使用中的區塊不到map的一半時，只把map中的指標輪轉，讓使用中的區塊回到中央
+    //   (另一端空出來的區塊因此輪到這一端重複使用)；否則把map加倍。兩種情況都只搬移指標，元素的位址不變。
+    void Recenter() {
+        std::size_t first = start_ / kBlock;
+        std::size_t used = size_ ? (start_ + size_ - 1) / kBlock - first + 1 : 0;
+        std::size_t new_map_size = map_size_ == 0 ? kMinMap : (used + 2 <= map_size_ / 2 ? map_size_ : 2 * map_size_);
+        std::size_t center = (new_map_size - used) / 2;
+        T** new_map = std::allocator<T*>().allocate(new_map_size);
+        std::fill(new_map, new_map + new_map_size, nullptr);
+        for(std::size_t j = 0; j < map_size_; j++) {  // * 舊map的每個指標(包含閒置的區塊)都搬到新map，不會遺失。
+            new_map[(center + j) % new_map_size] = map_[(first + j) % map_size_];
+        }
+        if(map_) std::allocator<T*>().deallocate(map_, map_size_);
+        map_ = new_map;
+        map_size_ = new_map_size;
+        start_ = center * kBlock + start_ % kBlock;
+    }
+    T** map_{};
+    std::size_t map_size_{};
+    std::size_t start_{};
+    std::size_t size_{};
+};
+
+template<typename T>
+typename Deque<T>::ConstIterator Begin(const Deque<T>& deq) {
+    return deq.Begin();
+}
+template<typename T>
+typename Deque<T>::ConstIterator End(const Deque<T>& deq) {
+    return deq.End();
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& os, const Deque<T>& deq) {
+    os << "[";
+    for(typename Deque<T>::ConstIterator it = Begin(deq); it != End(deq); it++) {
+        if(it != Begin(deq)) os << ", ";
+        os << *it;
+    }
+    os << "]";
+    return os;
+}
+}
+
+int main() {
+    STD::Deque<int> d {3, 4, 5};
+    d.PushFront(2);
+    d.PushFront(1);
+    d.PushBack(6);
+    std::cout << d << std::endl;                    // [1, 2, 3, 4, 5, 6]
+    d.PopFront();
+    d.PopBack();
+    std::cout << d.Front() << " " << d.Back() << " " << d[2] << std::endl; // 2 5 4
+
+    const int* third = &d[2];
+    for(int i = 0; i < 10000; i++) {                // * 新增大量元素，既有元素的位址不變。
+        d.PushFront(-i);
+        d.PushBack(i);
+    }
+    std::cout << (third == &d[10002]) << " " << d.Size() << std::endl;   // 1 20004
+    std::sort(d.begin(), d.end());                  // * 隨機存取迭代器，可以直接使用標準演算法。
+    std::cout << d.Front() << " " << d.Back() << std::endl;              // -9999 9999
+
+    STD::Deque<std::string> queue;                  // * 當作佇列使用：尾端新增、前端刪除。
+    for(int i = 0; i < 100000; i++) {
+        queue.PushBack(std::to_string(i));
+        if(queue.Size() > 3) queue.PopFront();
+    }
+    std::cout << queue << std::endl;                // [99997, 99998, 99999]
+    STD::Deque<std::string> copy = queue;
+    copy.EmplaceFront(2, 'x');
+    queue = std::move(copy);
+    queue.ShrinkToFit();
+    std::cout << queue << " " << copy.Size() << std::endl;               // [xx, 99997, 99998, 99999] 0
+    try {
+        queue.At(4);
+    } catch(const std::out_of_range& e) {
+        std::cout << e.what() << std::endl;         // Deque Index Out of Bound
+    }
+    return 0;
+}
\ No newline at end of file
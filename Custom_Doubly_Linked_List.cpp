@@ -1,4 +1,7 @@
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
 namespace STD{
 template<typename T>
 struct ListNode{
@@ -7,45 +10,55 @@ struct ListNode{
     ListNode* prev{};
 };
 
-template<typename T>
+// * Allocator: 節點的配置器(介面與標準容器相同)，內部會rebind成ListNode<T>的配置器。
+//   例如傳入std::pmr::polymorphic_allocator<T>並指向一個monotonic_buffer_resource，所有節點就都從同一塊arena配置。
+template<typename T, typename Allocator = std::allocator<T>>
 class List{
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
   public:
-    template<typename U> friend std::ostream& operator<<(std::ostream& os, const List<U>& lst);
+    template<typename U, typename A> friend std::ostream& operator<<(std::ostream& os, const List<U, A>& lst);
     List() = default;
-    List(const std::initializer_list<T>& lst) {
+    explicit List(const Allocator& alloc): alloc_(alloc) {}
+    List(const std::initializer_list<T>& lst, const Allocator& alloc = Allocator()): alloc_(alloc) {
         ListNode<T> tmp {};
         ListNode<T>* cur;
         cur = &tmp;
         for(const T& ele: lst) {
-            cur->next = new ListNode<T> {ele, nullptr, cur};
+            cur->next = NewNode(ele, nullptr, cur);
             cur = cur->next;
             size_++;
         }
         Head = tmp.next;
-        Head->prev = nullptr;
-        Tail = cur;
+        if(Head) Head->prev = nullptr;
+        Tail = Head ? cur : nullptr;
     }
-    List(const List& lst) {
+    List(const List& lst): List(lst, NodeAllocTraits::select_on_container_copy_construction(lst.alloc_)) {}
+    List(const List& lst, const Allocator& alloc): alloc_(alloc) {
         ListNode<T> tmp {};
         ListNode<T>* cur = &tmp;
         for(ListNode<T>* src = lst.Head; src != nullptr; src = src->next) {
-            cur->next = new ListNode<T> {src->val, nullptr, cur};
+            cur->next = NewNode(src->val, nullptr, cur);
             cur = cur->next;
             size_++;
         }
         Head = tmp.next;
-        Head->prev = nullptr;
-        Tail = cur;
+        if(Head) Head->prev = nullptr;
+        Tail = Head ? cur : nullptr;
     }
     List& operator=(const List& lst) {
         if(&lst == this) return *this;
-        List tmp = lst;
+        // * 暫存物件使用交換後*this應持有的配置器，交換節點之後每個節點仍然由配置它的配置器釋放。
+        List tmp(lst, NodeAllocTraits::propagate_on_container_copy_assignment::value ? lst.alloc_ : alloc_);
         std::swap(Head, tmp.Head);
         std::swap(Tail, tmp.Tail);        
         std::swap(size_, tmp.size_);
+        if constexpr(NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+            std::swap(alloc_, tmp.alloc_);
+        }
         return *this;
     }
-    List(List&& lst) {
+    List(List&& lst): alloc_(std::move(lst.alloc_)) {
         Head = lst.Head;
         Tail = lst.Tail;
         size_ = lst.size_;
@@ -55,20 +68,34 @@ class List{
     }
     List& operator=(List&& lst) {
         if(&lst == this) return *this;
-        List tmp = std::move(lst);
-        std::swap(Head, tmp.Head);
-        std::swap(Tail, tmp.Tail);
-        std::swap(size_, tmp.size_);
+        Clear();
+        if constexpr(NodeAllocTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(lst.alloc_);
+        }
+        if(alloc_ == lst.alloc_) {
+            std::swap(Head, lst.Head);
+            std::swap(Tail, lst.Tail);
+            std::swap(size_, lst.size_);
+        } else {                                // * 兩邊的配置器不相等時不能接手對方的節點，只能以自己的配置器逐一複製。
+            List tmp(lst, alloc_);
+            std::swap(Head, tmp.Head);
+            std::swap(Tail, tmp.Tail);
+            std::swap(size_, tmp.size_);
+            lst.Clear();
+        }
         return *this;
     }
     ~List() {
+        Clear();
+    }
+    void Clear() {
         while(!IsEmpty()) {
             PopFront();
         }
     }
-    T& operator[](int id) {
+    T& operator[](std::size_t id) {
         ListNode<T>* cur = Head;
-        int i = 0;
+        std::size_t i = 0;
         // if(!IsEmpty()) {
         while(id != i) {
             cur = cur->next;
@@ -77,9 +104,9 @@ class List{
         return cur->val;
         // }
     }
-    const T& operator[](int id) const {
+    const T& operator[](std::size_t id) const {
         ListNode<T>* cur = Head;
-        int i = 0;
+        std::size_t i = 0;
         // if(!IsEmpty()) {
         while(id != i) {
             cur = cur->next;
@@ -100,7 +127,7 @@ class List{
     const T& Back() const {
         return Tail->val;
     }
-    int Size() const {
+    std::size_t Size() const {
         return size_;
     }
     bool IsEmpty() {
@@ -108,20 +135,20 @@ class List{
     }
     void PushBack(const T& val) {
         if(!IsEmpty()) {
-            Tail->next = new ListNode<T> {val, nullptr, Tail};
+            Tail->next = NewNode(val, nullptr, Tail);
             Tail = Tail->next;
         } else {
-            Head = new ListNode<T> {val, nullptr, nullptr};
+            Head = NewNode(val, nullptr, nullptr);
             Tail = Head;
         }
         size_++;
     }
     void PushFront(const T& val) {
         if(!IsEmpty()) {
-            Head->prev = new ListNode<T> {val, Head, nullptr};
+            Head->prev = NewNode(val, Head, nullptr);
             Head = Head->prev;
         } else {
-            Head = new ListNode<T> {val, nullptr, nullptr};
+            Head = NewNode(val, nullptr, nullptr);
             Tail = Head;
         }
         size_++;
@@ -135,6 +162,7 @@ class List{
             }else{
                 Head = nullptr;
             }
+            DeleteNode(tmp);
             size_--;
         }
     }
@@ -147,7 +175,7 @@ class List{
             }else{
                 Tail = nullptr;
             }
-            delete tmp;
+            DeleteNode(tmp);
             size_--;
         }
     }
@@ -180,22 +208,37 @@ class List{
         return nullptr;
     }
   private:
+    ListNode<T>* NewNode(const T& val, ListNode<T>* next, ListNode<T>* prev) {
+        ListNode<T>* node = NodeAllocTraits::allocate(alloc_, 1);
+        try {
+            new (node) ListNode<T> {val, next, prev};
+        } catch(...) {
+            NodeAllocTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+    void DeleteNode(ListNode<T>* node) {
+        node->~ListNode<T>();
+        NodeAllocTraits::deallocate(alloc_, node, 1);
+    }
     ListNode<T>* Head{};
     ListNode<T>* Tail{};
-    int size_{};
+    std::size_t size_{};
+    NodeAlloc alloc_{};
 };
 
-template<typename T>
-typename List<T>::Iterator Begin(const List<T>& lst) {
+template<typename T, typename Allocator>
+typename List<T, Allocator>::Iterator Begin(const List<T, Allocator>& lst) {
     return lst.Begin();
 }
-template<typename T>
-typename List<T>::Iterator End(const List<T>& lst) {
+template<typename T, typename Allocator>
+typename List<T, Allocator>::Iterator End(const List<T, Allocator>& lst) {
     return lst.End();
 }
 
-template<typename T>
-std::ostream& operator<<(std::ostream& os, const List<T>& lst) {
+template<typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& os, const List<T, Allocator>& lst) {
     os << "[";
     for(auto cur = lst.Begin(); cur != lst.End(); cur++) {
         if(cur != lst.Begin()) os << ", ";
@@ -254,5 +297,16 @@ int main() {
     std::cout << ll3 << std::endl;  // []
     std::cout << ll4 << std::endl;  // [12, 34, 56, 888, 90]
 
+    /* 以monotonic arena配置節點：個別節點的釋放都是no-op，離開scope時arena一次釋放全部記憶體 */
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        STD::List<int, std::pmr::polymorphic_allocator<int>> pl({1, 2, 3}, &arena);
+        pl.PushFront(0);
+        pl.PushBack(4);
+        STD::List<int, std::pmr::polymorphic_allocator<int>> pl2(&arena);
+        pl2 = pl;
+        std::cout << pl2 << std::endl;  // [0, 1, 2, 3, 4]
+    }
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,537 @@
+#include <iostream>
+#include <memory>
+#include <array>
+#include <string>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+namespace STD{
+// * 多維陣列的記憶體佈局(layout)：由各維度的大小(extents)算出每一維的步長(strides)，元素(i0, i1, ...)的位置是sum(ik * stride[k])。
+// * RowMajor: 列為主(C的多維陣列)，最後一維連續存放。
+struct RowMajor{
+    template<std::size_t Rank>
+    static constexpr std::array<std::size_t, Rank> Strides(const std::array<std::size_t, Rank>& extents) {
+        std::array<std::size_t, Rank> strides{};
+        std::size_t stride = 1;
+        for(std::size_t d = Rank; d-- > 0;) {
+            strides[d] = stride;
+            stride *= extents[d];
+        }
+        return strides;
+    }
+};
+// * ColumnMajor: 行為主(Fortran、BLAS)，第一維連續存放。
+struct ColumnMajor{
+    template<std::size_t Rank>
+    static constexpr std::array<std::size_t, Rank> Strides(const std::array<std::size_t, Rank>& extents) {
+        std::array<std::size_t, Rank> strides{};
+        std::size_t stride = 1;
+        for(std::size_t d = 0; d < Rank; d++) {
+            strides[d] = stride;
+            stride *= extents[d];
+        }
+        return strides;
+    }
+};
+
+// * MdView: 指向多維元素的非擁有(non-owning)視圖，由起點指標、各維大小與各維步長組成。
+//   步長可以是任意值，因此子區塊、每隔k個取一個的取樣都只是另一個MdView，不需要複製任何元素。
+template<typename T, std::size_t Rank>
+class MdView{
+    static_assert(Rank > 0, "MdView needs at least one dimension");
+  public:
+    using Index = std::array<std::size_t, Rank>;
+    // * ForEachBlock預設的區塊大小：整個區塊約16 KiB，與輸出一起放得進32 KiB的L1 cache。
+    static constexpr std::size_t kTileBytes = 16 * 1024;
+    MdView(T* data, const Index& extents, const Index& strides): data_(data), extents_(extents), strides_(strides) {}
+    // * MdView<T>可以隱式轉成MdView<const T>。
+    operator MdView<const T, Rank>() const {
+        return {data_, extents_, strides_};
+    }
+    template<typename... I>
+    T& operator()(I... idx) const {
+        static_assert(sizeof...(I) == Rank, "MdView Index Rank Mismatch");
+        return (*this)[Index{static_cast<std::size_t>(idx)...}];
+    }
+    T& operator[](const Index& idx) const {
+        std::size_t offset = 0;
+        for(std::size_t d = 0; d < Rank; d++) {
+            offset += idx[d] * strides_[d];
+        }
+        return data_[offset];
+    }
+    T& At(const Index& idx) const {
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(idx[d] >= extents_[d]) throw std::out_of_range("MdView Index Out of Bound");
+        }
+        return (*this)[idx];
+    }
+    std::size_t Extent(std::size_t d) const {
+        return extents_[d];
+    }
+    std::size_t Stride(std::size_t d) const {
+        return strides_[d];
+    }
+    const Index& Extents() const {
+        return extents_;
+    }
+    std::size_t Size() const {
+        std::size_t size = 1;
+        for(std::size_t d = 0; d < Rank; d++) {
+            size *= extents_[d];
+        }
+        return size;
+    }
+    T* data() const {
+        return data_;
+    }
+    // * 從first開始、每一維取sizes[d]個元素、每隔steps[d]取一個的子視圖；與原本的視圖共用元素。
+    MdView SubView(const Index& first, const Index& sizes, Index steps = Ones()) const {
+        Index strides;
+        bool empty = false;
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(steps[d] == 0 || (sizes[d] && first[d] + (sizes[d] - 1) * steps[d] >= extents_[d])) {
+                throw std::out_of_range("MdView SubView Out of Bound");
+            }
+            strides[d] = strides_[d] * steps[d];
+            empty = empty || sizes[d] == 0;
+        }
+        return {empty ? data_ : &(*this)[first], sizes, strides};
+    }
+    // * 對每個元素呼叫f(T&)。外層迴圈走步長最大的維度、最內層走步長最小的維度，
+    //   因此不論RowMajor、ColumnMajor或子視圖，都是以接近記憶體的順序存取。
+    template<typename F>
+    void ForEach(F&& f) const {
+        if(Size() == 0) return;
+        Index order = Order();
+        Walk(order, 0, data_, f);
+    }
+    // * 分塊(tiled)走訪：把索引空間切成每塊block[d]大小的區塊(邊緣的區塊較小)，對每一塊呼叫f(first, tile)，
+    //   first是區塊在本視圖中的起點，tile是該區塊的子視圖。模板運算(stencil)在一個區塊內反覆讀寫鄰近元素，
+    //   工作集合只有一個區塊大小，會一直留在L1/L2中，而不是每一列都把整個陣列掃過一次。
+    template<typename F>
+    void ForEachBlock(const Index& block, F&& f) const {
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(block[d] == 0) throw std::invalid_argument("MdView Block Size Is Zero");
+        }
+        if(Size() == 0) return;
+        Index order = Order();
+        Index first{};
+        WalkBlocks(order, 0, block, first, f);
+    }
+    template<typename F>
+    void ForEachBlock(F&& f) const {
+        ForEachBlock(DefaultBlock(), std::forward<F>(f));
+    }
+    // * 每一維相同邊長e的區塊，e是e^Rank * sizeof(T) <= kTileBytes的最大2的冪次(不超過該維大小)。
+    Index DefaultBlock() const {
+        std::size_t elems = std::max<std::size_t>(1, kTileBytes / sizeof(T));
+        std::size_t edge = 1;
+        while(Power(edge * 2) <= elems) {
+            edge *= 2;
+        }
+        Index block;
+        for(std::size_t d = 0; d < Rank; d++) {
+            block[d] = std::max<std::size_t>(1, std::min(edge, extents_[d]));
+        }
+        return block;
+    }
+  private:
+    static Index Ones() {
+        Index ones;
+        ones.fill(1);
+        return ones;
+    }
+    static std::size_t Power(std::size_t edge) {
+        std::size_t res = 1;
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(res > std::numeric_limits<std::size_t>::max() / edge) return std::numeric_limits<std::size_t>::max();
+            res *= edge;
+        }
+        return res;
+    }
+    // * 依步長由大到小排列的維度。
+    Index Order() const {
+        Index order;
+        for(std::size_t d = 0; d < Rank; d++) {
+            order[d] = d;
+        }
+        std::stable_sort(order.begin(), order.end(), [this](std::size_t a, std::size_t b) { return strides_[a] > strides_[b]; });
+        return order;
+    }
+    template<typename F>
+    void Walk(const Index& order, std::size_t level, T* p, F& f) const {
+        std::size_t d = order[level];
+        if(level + 1 == Rank) {
+            for(std::size_t i = 0; i < extents_[d]; i++) {
+                f(p[i * strides_[d]]);
+            }
+            return;
+        }
+        for(std::size_t i = 0; i < extents_[d]; i++) {
+            Walk(order, level + 1, p + i * strides_[d], f);
+        }
+    }
+    template<typename F>
+    void WalkBlocks(const Index& order, std::size_t level, const Index& block, Index& first, F& f) const {
+        if(level == Rank) {
+            Index sizes;
+            for(std::size_t d = 0; d < Rank; d++) {
+                sizes[d] = std::min(block[d], extents_[d] - first[d]);
+            }
+            f(static_cast<const Index&>(first), SubView(first, sizes));
+            return;
+        }
+        std::size_t d = order[level];
+        for(first[d] = 0; first[d] < extents_[d]; first[d] += block[d]) {
+            WalkBlocks(order, level + 1, block, first, f);
+        }
+        first[d] = 0;
+    }
+    T* data_;
+    Index extents_;
+    Index strides_;
+};
+
+// * BasicMdArray: 編譯期決定各維大小的多維陣列，元素連續存放在物件內部(與Array一樣不需要heap)。
+//   取代Array<Array<T, M>, N>：索引計算只有一次乘加，佈局可以選擇，也能交出子視圖與分塊走訪。
+template<typename T, typename Layout, std::size_t... Extents>
+class BasicMdArray{
+  public:
+    static constexpr std::size_t kRank = sizeof...(Extents);
+    static constexpr std::size_t kSize = (Extents * ...);
+    static_assert(kRank > 0 && kSize > 0, "MdArray needs non-empty extents");
+    using View = MdView<T, kRank>;
+    using ConstView = MdView<const T, kRank>;
+    using Index = typename View::Index;
+    static constexpr Index kExtents{Extents...};
+    static constexpr Index kStrides = Layout::template Strides<kRank>(kExtents);
+    template<typename... I>
+    T& operator()(I... idx) {
+        static_assert(sizeof...(I) == kRank, "MdArray Index Rank Mismatch");
+        return data_[Offset(Index{static_cast<std::size_t>(idx)...})];
+    }
+    template<typename... I>
+    const T& operator()(I... idx) const {
+        static_assert(sizeof...(I) == kRank, "MdArray Index Rank Mismatch");
+        return data_[Offset(Index{static_cast<std::size_t>(idx)...})];
+    }
+    T& At(const Index& idx) {
+        CheckIndex(idx);
+        return data_[Offset(idx)];
+    }
+    const T& At(const Index& idx) const {
+        CheckIndex(idx);
+        return data_[Offset(idx)];
+    }
+    static constexpr std::size_t Extent(std::size_t d) {
+        return kExtents[d];
+    }
+    static constexpr std::size_t Size() {
+        return kSize;
+    }
+    void Fill(const T& val) {
+        std::fill(data_, data_ + kSize, val);
+    }
+    View GetView() {
+        return {data_, kExtents, kStrides};
+    }
+    ConstView GetView() const {
+        return {data_, kExtents, kStrides};
+    }
+    View SubView(const Index& first, const Index& sizes, const Index& steps = Ones()) {
+        return GetView().SubView(first, sizes, steps);
+    }
+    ConstView SubView(const Index& first, const Index& sizes, const Index& steps = Ones()) const {
+        return GetView().SubView(first, sizes, steps);
+    }
+    // * 依記憶體順序走訪全部元素時直接使用連續的data()、begin()、end()。
+    T* data() {
+        return data_;
+    }
+    const T* data() const {
+        return data_;
+    }
+    constexpr std::size_t size() const {
+        return kSize;
+    }
+    T* begin() {
+        return data_;
+    }
+    const T* begin() const {
+        return data_;
+    }
+    T* end() {
+        return data_ + kSize;
+    }
+    const T* end() const {
+        return data_ + kSize;
+    }
+  private:
+    static constexpr Index Ones() {
+        Index ones{};
+        for(std::size_t d = 0; d < kRank; d++) {
+            ones[d] = 1;
+        }
+        return ones;
+    }
+    static constexpr std::size_t Offset(const Index& idx) {
+        std::size_t offset = 0;
+        for(std::size_t d = 0; d < kRank; d++) {
+            offset += idx[d] * kStrides[d];
+        }
+        return offset;
+    }
+    static void CheckIndex(const Index& idx) {
+        for(std::size_t d = 0; d < kRank; d++) {
+            if(idx[d] >= kExtents[d]) throw std::out_of_range("MdArray Index Out of Bound");
+        }
+    }
+    T data_[kSize]{};
+};
+template<typename T, std::size_t... Extents>
+using MdArray = BasicMdArray<T, RowMajor, Extents...>;
+
+// * MdVector: 執行時決定各維大小的多維陣列，元素連續存放在heap上的一塊記憶體中。
+template<typename T, std::size_t Rank, typename Layout = RowMajor>
+class MdVector{
+  public:
+    using View = MdView<T, Rank>;
+    using ConstView = MdView<const T, Rank>;
+    using Index = typename View::Index;
+    MdVector() {
+        extents_.fill(0);
+        strides_ = Layout::template Strides<Rank>(extents_);
+    }
+    template<typename... E, typename = std::enable_if_t<sizeof...(E) == Rank && (std::is_integral_v<E> && ...)>>
+    explicit MdVector(E... extents): MdVector(Index{static_cast<std::size_t>(extents)...}) {}
+    explicit MdVector(const Index& extents, const T& val = T()): extents_(extents) {
+        strides_ = Layout::template Strides<Rank>(extents_);
+        size_ = CheckedSize(extents_);
+        data_ = std::make_unique<T[]>(size_);
+        std::fill(data_.get(), data_.get() + size_, val);
+    }
+    MdVector(const MdVector& other): MdVector(other.extents_) {
+        std::copy(other.begin(), other.end(), data_.get());
+    }
+    MdVector& operator=(const MdVector& other) {
+        if(&other == this) return *this;
+        MdVector tmp = other;
+        Swap(tmp);
+        return *this;
+    }
+    MdVector(MdVector&& other) noexcept: MdVector() {
+        Swap(other);
+    }
+    MdVector& operator=(MdVector&& other) noexcept {
+        if(&other == this) return *this;
+        MdVector tmp = std::move(other);
+        Swap(tmp);
+        return *this;
+    }
+    template<typename... I>
+    T& operator()(I... idx) {
+        static_assert(sizeof...(I) == Rank, "MdVector Index Rank Mismatch");
+        return data_[Offset(Index{static_cast<std::size_t>(idx)...})];
+    }
+    template<typename... I>
+    const T& operator()(I... idx) const {
+        static_assert(sizeof...(I) == Rank, "MdVector Index Rank Mismatch");
+        return data_[Offset(Index{static_cast<std::size_t>(idx)...})];
+    }
+    T& At(const Index& idx) {
+        CheckIndex(idx);
+        return data_[Offset(idx)];
+    }
+    const T& At(const Index& idx) const {
+        CheckIndex(idx);
+        return data_[Offset(idx)];
+    }
+    std::size_t Extent(std::size_t d) const {
+        return extents_[d];
+    }
+    const Index& Extents() const {
+        return extents_;
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    void Fill(const T& val) {
+        std::fill(begin(), end(), val);
+    }
+    // * 元素總數不變時重新解讀各維大小(例如6x4變成3x8)，不搬移元素。
+    void Reshape(const Index& extents) {
+        if(CheckedSize(extents) != size_) throw std::invalid_argument("MdVector Reshape Size Mismatch");
+        extents_ = extents;
+        strides_ = Layout::template Strides<Rank>(extents_);
+    }
+    void Swap(MdVector& other) {
+        std::swap(other.data_, data_);
+        std::swap(other.extents_, extents_);
+        std::swap(other.strides_, strides_);
+        std::swap(other.size_, size_);
+    }
+    View GetView() {
+        return {data_.get(), extents_, strides_};
+    }
+    ConstView GetView() const {
+        return {data_.get(), extents_, strides_};
+    }
+    View SubView(const Index& first, const Index& sizes) {
+        return GetView().SubView(first, sizes);
+    }
+    View SubView(const Index& first, const Index& sizes, const Index& steps) {
+        return GetView().SubView(first, sizes, steps);
+    }
+    ConstView SubView(const Index& first, const Index& sizes) const {
+        return GetView().SubView(first, sizes);
+    }
+    ConstView SubView(const Index& first, const Index& sizes, const Index& steps) const {
+        return GetView().SubView(first, sizes, steps);
+    }
+    T* data() {
+        return data_.get();
+    }
+    const T* data() const {
+        return data_.get();
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    T* begin() {
+        return data_.get();
+    }
+    const T* begin() const {
+        return data_.get();
+    }
+    T* end() {
+        return data_.get() + size_;
+    }
+    const T* end() const {
+        return data_.get() + size_;
+    }
+  private:
+    static std::size_t CheckedSize(const Index& extents) {
+        std::size_t size = 1;
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(extents[d] && size > std::numeric_limits<std::size_t>::max() / sizeof(T) / extents[d]) {
+                throw std::length_error("MdVector Too Large");
+            }
+            size *= extents[d];
+        }
+        return size;
+    }
+    std::size_t Offset(const Index& idx) const {
+        std::size_t offset = 0;
+        for(std::size_t d = 0; d < Rank; d++) {
+            offset += idx[d] * strides_[d];
+        }
+        return offset;
+    }
+    void CheckIndex(const Index& idx) const {
+        for(std::size_t d = 0; d < Rank; d++) {
+            if(idx[d] >= extents_[d]) throw std::out_of_range("MdVector Index Out of Bound");
+        }
+    }
+    std::unique_ptr<T[]> data_;
+    Index extents_;
+    Index strides_;
+    std::size_t size_{};
+};
+
+// * 以巢狀的中括號輸出，第一維在最外層，例如2x3為[[a, b, c], [d, e, f]]。
+template<typename T, std::size_t Rank>
+void Print(std::ostream& os, const MdView<T, Rank>& view, std::size_t level, const T* p) {
+    os << "[";
+    for(std::size_t i = 0; i < view.Extent(level); i++) {
+        if(i) os << ", ";
+        if(level + 1 == Rank) {
+            os << p[i * view.Stride(level)];
+        } else {
+            Print<T, Rank>(os, view, level + 1, p + i * view.Stride(level));
+        }
+    }
+    os << "]";
+}
+template<typename T, std::size_t Rank>
+std::ostream& operator<<(std::ostream& os, const MdView<T, Rank>& view) {
+    Print<T, Rank>(os, view, 0, view.data());
+    return os;
+}
+template<typename T, typename Layout, std::size_t... Extents>
+std::ostream& operator<<(std::ostream& os, const BasicMdArray<T, Layout, Extents...>& arr) {
+    return os << arr.GetView();
+}
+template<typename T, std::size_t Rank, typename Layout>
+std::ostream& operator<<(std::ostream& os, const MdVector<T, Rank, Layout>& vec) {
+    return os << vec.GetView();
+}
+}
+
+int main() {
+    STD::MdArray<int, 3, 4> grid;                       // * 取代Array<Array<int, 4>, 3>，12個int連續存放。
+    for(std::size_t i = 0; i < 3; i++) {
+        for(std::size_t j = 0; j < 4; j++) {
+            grid(i, j) = static_cast<int>(10 * i + j);
+        }
+    }
+    std::cout << grid << std::endl;                     // [[0, 1, 2, 3], [10, 11, 12, 13], [20, 21, 22, 23]]
+    STD::BasicMdArray<int, STD::ColumnMajor, 3, 4> columns;
+    std::copy(grid.begin(), grid.end(), columns.begin());
+    std::cout << columns(1, 0) << " " << columns(0, 1) << std::endl; // 1 3 (第一維連續存放)
+
+    auto odd = grid.SubView({0, 1}, {3, 2}, {1, 2});    // * 第1、3行，不複製元素。
+    std::cout << odd << " " << odd.Stride(1) << std::endl;           // [[1, 3], [11, 13], [21, 23]] 2
+    odd.ForEach([](int& val) { val = -val; });
+    std::cout << grid.SubView({1, 0}, {1, 4}) << std::endl;          // [[10, -11, 12, -13]]
+
+    // * 5點模板運算(stencil)：以分塊走訪逐塊計算，每一塊的工作集合都留在cache中。
+    const std::size_t n = 300;
+    STD::MdVector<double, 2> in(n, n);
+    for(std::size_t i = 0; i < n; i++) {
+        for(std::size_t j = 0; j < n; j++) {
+            in(i, j) = std::sin(0.01 * i) * std::cos(0.02 * j);
+        }
+    }
+    STD::MdVector<double, 2> out(n, n);
+    STD::MdVector<double, 2>::ConstView src = in.GetView();
+    out.SubView({1, 1}, {n - 2, n - 2}).ForEachBlock([&](const auto& first, auto tile) {
+        for(std::size_t i = 0; i < tile.Extent(0); i++) {
+            for(std::size_t j = 0; j < tile.Extent(1); j++) {
+                std::size_t y = first[0] + i + 1;
+                std::size_t x = first[1] + j + 1;
+                tile(i, j) = 0.2 * (src(y, x) + src(y - 1, x) + src(y + 1, x) + src(y, x - 1) + src(y, x + 1));
+            }
+        }
+    });
+    bool same = true;
+    for(std::size_t y = 1; y + 1 < n; y++) {
+        for(std::size_t x = 1; x + 1 < n; x++) {
+            double expect = 0.2 * (in(y, x) + in(y - 1, x) + in(y + 1, x) + in(y, x - 1) + in(y, x + 1));
+            same = same && out(y, x) == expect;
+        }
+    }
+    auto block = out.GetView().DefaultBlock();
+    std::cout << same << " " << block[0] << "x" << block[1] << std::endl; // 1 32x32
+
+    STD::MdVector<int, 3, STD::ColumnMajor> cube(2, 3, 4);
+    int next = 0;
+    cube.GetView().ForEach([&next](int& val) { val = next++; });          // * 依記憶體順序：第一維變化最快。
+    std::cout << cube(1, 0, 0) << " " << cube(0, 1, 0) << " " << cube(0, 0, 1) << std::endl; // 1 2 6
+    cube.Reshape({4, 3, 2});
+    STD::MdVector<int, 3, STD::ColumnMajor> copy = cube;
+    std::cout << copy.SubView({0, 0, 1}, {4, 1, 1}) << std::endl;        // [[[12]], [[13]], [[14]], [[15]]]
+    try {
+        copy.At({4, 0, 0});
+    } catch(const std::out_of_range& e) {
+        std::cout << e.what() << std::endl;                               // MdVector Index Out of Bound
+    }
+    return 0;
+}
\ No newline at end of file
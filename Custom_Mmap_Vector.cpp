@@ -0,0 +1,281 @@
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <cstdio>
+#include <algorithm>
+#include <type_traits>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+namespace STD{
+// * MmapVector: 介面與Vector相同，但元素存放在以mmap映射到記憶體的檔案中，而不是heap上。
+//   開檔只建立映射而不讀取資料，實際的讀寫交給作業系統的page cache依需要換入換出，因此可以處理比RAM還大的資料表。
+//   檔案格式：64 bytes的標頭(magic、元素大小、元素個數)，後面緊接著連續存放的元素；容量以ftruncate延長檔案並以
+//   mremap擴大映射。元素以原始位元組存放，因此T必須是trivially copyable。
+//   索引與大小使用std::size_t，超過2^31個元素的資料表也能正確定址。
+template<typename T>
+class MmapVector{
+    static_assert(std::is_trivially_copyable_v<T>, "MmapVector stores elements as raw bytes");
+    static_assert(alignof(T) <= 64, "MmapVector aligns elements to the 64-byte header");
+    template<typename U> friend std::ostream& operator<<(std::ostream& os, const MmapVector<U>& vec);
+  public:
+    // * 提供給作業系統的存取模式提示(madvise)：循序掃描時預讀更積極，隨機存取時關閉預讀。
+    enum class Access{ kNormal, kSequential, kRandom, kWillNeed };
+    // * 開啟path；檔案不存在時建立一個空的MmapVector檔案。
+    explicit MmapVector(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if(fd_ < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+        struct stat st;
+        if(::fstat(fd_, &st) != 0) Fail("fstat");
+        if(st.st_size == 0) {
+            if(::ftruncate(fd_, kDataOffset) != 0) Fail("ftruncate");
+            Map(kDataOffset);
+            std::memcpy(GetHeader()->magic, kMagic, sizeof(kMagic));
+            GetHeader()->elem_size = sizeof(T);
+            GetHeader()->size = 0;
+        } else {
+            if(static_cast<std::size_t>(st.st_size) < kDataOffset) Fail("not an MmapVector file", EINVAL);
+            Map(st.st_size);
+            if(std::memcmp(GetHeader()->magic, kMagic, sizeof(kMagic)) != 0 || GetHeader()->elem_size != sizeof(T)) {
+                Fail("not an MmapVector file of this element type", EINVAL);
+            }
+            capacity_ = (st.st_size - kDataOffset) / sizeof(T);
+            if(GetHeader()->size > capacity_) Fail("corrupt MmapVector header: element count exceeds file size", EINVAL);
+            size_ = GetHeader()->size;
+        }
+        owns_layout_ = true;
+    }
+    MmapVector(const MmapVector&) = delete;
+    MmapVector& operator=(const MmapVector&) = delete;
+    MmapVector(MmapVector&& other) noexcept {
+        Steal(other);
+    }
+    MmapVector& operator=(MmapVector&& other) noexcept {
+        if(&other == this) return *this;
+        Close();
+        Steal(other);
+        return *this;
+    }
+    ~MmapVector() {
+        Close();
+    }
+    T& operator[](std::size_t id) {
+        return Data()[id];
+    }
+    const T& operator[](std::size_t id) const {
+        return Data()[id];
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    std::size_t Capacity() const {
+        return capacity_;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    T& Front() {
+        return Data()[0];
+    }
+    const T& Front() const {
+        return Data()[0];
+    }
+    T& Back() {
+        return Data()[size_-1];
+    }
+    const T& Back() const {
+        return Data()[size_-1];
+    }
+    void Reserve(std::size_t new_capacity) {
+        if(new_capacity > capacity_) Grow(new_capacity);
+    }
+    void Resize(std::size_t new_size) {
+        if(new_size > capacity_) {
+            Grow(2*(new_size+1));
+        }
+        if(new_size > size_) {                  // * 之前縮小時留下的舊資料要清回T{}，延長檔案所得的新頁面本來就是0。
+            std::fill(Data() + size_, Data() + new_size, T{});
+        }
+        SetSize(new_size);
+    }
+    void PushBack(const T& val) {
+        if(size_ == capacity_) {
+            T tmp = val;                        // * mremap可能搬移映射位址，val參考到自身元素時先複製一份。
+            Grow(2*(size_+1));
+            Data()[size_] = tmp;
+        } else {
+            Data()[size_] = val;
+        }
+        SetSize(size_ + 1);
+    }
+    void PopBack() {
+        if(!Empty()) SetSize(size_ - 1);
+    }
+    void Fill(const T& val) {
+        std::fill(Data(), Data() + size_, val);
+    }
+    void Advise(Access access) {
+        access_ = access;
+        ApplyAdvice();
+    }
+    // * 把修改過的頁面同步寫回檔案(不呼叫時由作業系統自行決定寫回的時機，關閉時也會寫回)。
+    void Sync() {
+        if(mapping_ && ::msync(mapping_, mapped_bytes_, MS_SYNC) != 0) Fail("msync");
+    }
+    class ConstIterator{
+      public:
+        ConstIterator(const T* ptr): ptr_(ptr) {}
+        bool operator!=(const ConstIterator& other) {
+            return ptr_ != other.ptr_;
+        }
+        const T& operator*() {
+            return *ptr_;
+        }
+        const T* operator++(int) {
+            return ptr_++;
+        }
+      private:
+        const T* ptr_;
+    };
+    ConstIterator Begin() const {
+        return {Data()};
+    }
+    ConstIterator End() const {
+        return {Data() + size_};
+    }
+  private:
+    struct Header{
+        char magic[8];
+        std::uint64_t elem_size;
+        std::uint64_t size;
+    };
+    static constexpr char kMagic[8] = {'S', 'T', 'D', 'M', 'V', 'E', 'C', '1'};
+    static constexpr std::size_t kDataOffset = 64;
+    Header* GetHeader() const {
+        return reinterpret_cast<Header*>(mapping_);
+    }
+    T* Data() const {
+        return reinterpret_cast<T*>(mapping_ + kDataOffset);
+    }
+    [[noreturn]] void Fail(const char* what, int err = errno) {
+        Close();
+        throw std::system_error(err, std::generic_category(), what);
+    }
+    void SetSize(std::size_t new_size) {
+        size_ = new_size;
+        GetHeader()->size = new_size;           // * 標頭隨時保持最新，程式異常結束時檔案內容仍然一致。
+    }
+    void Map(std::size_t bytes) {
+        void* ptr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if(ptr == MAP_FAILED) Fail("mmap");
+        mapping_ = static_cast<char*>(ptr);
+        mapped_bytes_ = bytes;
+    }
+    // * 延長檔案並以mremap擴大映射；核心可以直接搬移頁表，不需要複製任何資料。
+    void Grow(std::size_t new_capacity) {
+        std::size_t new_bytes = kDataOffset + new_capacity * sizeof(T);
+        if(::ftruncate(fd_, new_bytes) != 0) throw std::system_error(errno, std::generic_category(), "ftruncate");
+        void* ptr = ::mremap(mapping_, mapped_bytes_, new_bytes, MREMAP_MAYMOVE);
+        if(ptr == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "mremap");
+        mapping_ = static_cast<char*>(ptr);
+        mapped_bytes_ = new_bytes;
+        capacity_ = new_capacity;
+        ApplyAdvice();
+    }
+    void ApplyAdvice() {
+        static constexpr int kAdvice[] = {MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED};
+        if(mapping_) ::madvise(mapping_, mapped_bytes_, kAdvice[static_cast<int>(access_)]);
+    }
+    // * 關閉時把檔案截短到剛好容納size_個元素，多餘的容量不會留在磁碟上。
+    //   只有成功開啟(確認是本型別的MmapVector檔案)之後才截短；開啟失敗時檔案維持原狀，不是MmapVector的檔案不會被破壞。
+    void Close() {
+        if(mapping_) ::munmap(mapping_, mapped_bytes_);
+        if(owns_layout_) {
+            int rc = ::ftruncate(fd_, kDataOffset + size_ * sizeof(T));
+            (void)rc;                           // * 截短失敗時檔案只是比需要的大，標頭中的元素個數仍然正確。
+        }
+        if(fd_ >= 0) ::close(fd_);
+        mapping_ = nullptr;
+        mapped_bytes_ = 0;
+        fd_ = -1;
+        size_ = capacity_ = 0;
+        owns_layout_ = false;
+    }
+    void Steal(MmapVector& other) {
+        fd_ = std::exchange(other.fd_, -1);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+        mapped_bytes_ = std::exchange(other.mapped_bytes_, 0);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        access_ = other.access_;
+        owns_layout_ = std::exchange(other.owns_layout_, false);
+    }
+    int fd_{-1};
+    char* mapping_{};
+    std::size_t mapped_bytes_{};
+    std::size_t size_{};
+    std::size_t capacity_{};
+    Access access_{Access::kNormal};
+    bool owns_layout_{false};
+};
+
+template<typename T>
+typename MmapVector<T>::ConstIterator Begin(const MmapVector<T>& vec) {
+    return vec.Begin();
+}
+template<typename T>
+typename MmapVector<T>::ConstIterator End(const MmapVector<T>& vec) {
+    return vec.End();
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& os, const MmapVector<T>& vec) {
+    os << "[";
+    for(typename MmapVector<T>::ConstIterator it = Begin(vec); it != End(vec); it++) {
+        if(it != Begin(vec)) os << ", ";
+        os << *it;
+    }
+    os << "]";
+    return os;
+}
+}
+
+int main() {
+    const std::string path = "mmap_vector_demo.bin";
+    std::remove(path.c_str());
+    {
+        STD::MmapVector<int> v(path);
+        for(int i = 1; i <= 5; i++) {
+            v.PushBack(i * 10);
+        }
+        v[2] = 7;
+        std::cout << v << std::endl;           // [10, 20, 7, 40, 50]
+    }                                          // * 解構時解除映射，資料已經在檔案裡。
+    {
+        STD::MmapVector<int> v(path);          // * 重新開啟只建立映射，不讀取資料。
+        v.Advise(STD::MmapVector<int>::Access::kSequential);
+        std::cout << v << std::endl;           // [10, 20, 7, 40, 50]
+        v.Resize(7);
+        v.Back() = 70;
+        std::cout << v << std::endl;           // [10, 20, 7, 40, 50, 0, 70]
+        v.Resize(2);
+        v.Resize(3);
+        std::cout << v << std::endl;           // [10, 20, 0]
+        STD::MmapVector<int> w = std::move(v);
+        w.PushBack(w[0]);
+        w.Sync();
+        std::cout << w.Size() << std::endl;    // 4
+    }
+    try {
+        STD::MmapVector<double> wrong(path);   // * 元素大小與檔案標頭不符。
+    } catch(const std::system_error& e) {
+        std::cout << "error: " << e.what() << std::endl;  // error: not an MmapVector file of this element type: Invalid argument
+    }
+    std::remove(path.c_str());
+    return 0;
+}
\ No newline at end of file
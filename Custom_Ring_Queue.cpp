@@ -0,0 +1,317 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+namespace STD{
+// * 一條cache line的大小。索引各自放在不同的cache line上，生產者與消費者更新自己的索引時才不會互相讓對方的cache失效(false sharing)。
+//   std::hardware_destructive_interference_size在各編譯器的支援不一致，這裡直接使用x86與多數ARM的64 bytes。
+inline constexpr std::size_t kCacheLine = 64;
+
+// * 一個未初始化、對齊T的元素位置；與Array一樣固定放在物件內部，但只有放入的元素才會被建構。
+template<typename T>
+struct RingSlot{
+    alignas(T) unsigned char bytes[sizeof(T)];
+    T* Get() {
+        return std::launder(reinterpret_cast<T*>(bytes));
+    }
+};
+
+// * SpscRing: 單一生產者、單一消費者(single-producer single-consumer)的環狀佇列，不需要mutex也不需要CAS。
+//   容量N必須是2的冪次，索引只會一直增加，位置是idx & (N-1)。生產者只寫tail_，消費者只寫head_，
+//   各自再保留一份對方索引的快取(cached_head_、cached_tail_)，只有快取顯示已滿/已空時才去讀對方的cache line，
+//   因此穩定傳輸時每次Push/Pop幾乎不會碰到另一個核心的cache line。
+template<typename T, std::size_t N>
+class SpscRing{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+    static constexpr std::size_t kMask = N - 1;
+  public:
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    ~SpscRing() {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        for(; head != tail; head++) {
+            std::destroy_at(slots_[head & kMask].Get());
+        }
+    }
+    // * 以下三個只能由生產者執行緒呼叫；已滿時回傳false，不會等待。
+    bool TryPush(const T& val) {
+        return TryEmplace(val);
+    }
+    bool TryPush(T&& val) {
+        return TryEmplace(std::move(val));
+    }
+    template<typename... Args>
+    bool TryEmplace(Args&&... args) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if(tail - cached_head_ == N) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if(tail - cached_head_ == N) return false;
+        }
+        new (slots_[tail & kMask].bytes) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+    // * 批次放入[first, first + count)中盡可能多的元素，回傳實際放入的個數；整批只發佈一次tail_。
+    //   某個元素的建構子拋出例外時，這一批已建構的元素全部解構後再重新拋出，tail_沒有發佈，佇列維持原狀。
+    template<typename InputIt>
+    std::size_t PushBatch(InputIt first, std::size_t count) {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if(N - (tail - cached_head_) < count) cached_head_ = head_.load(std::memory_order_acquire);
+        std::size_t n = std::min(count, N - (tail - cached_head_));
+        std::size_t built = 0;
+        try {
+            for(; built < n; built++, ++first) {
+                new (slots_[(tail + built) & kMask].bytes) T(*first);
+            }
+        } catch(...) {
+            for(std::size_t i = 0; i < built; i++) {
+                std::destroy_at(slots_[(tail + i) & kMask].Get());
+            }
+            throw;
+        }
+        if(n) tail_.store(tail + n, std::memory_order_release);
+        return n;
+    }
+    // * 以下兩個只能由消費者執行緒呼叫；已空時回傳false，不會等待。
+    bool TryPop(T& out) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if(head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if(head == cached_tail_) return false;
+        }
+        T* slot = slots_[head & kMask].Get();
+        out = std::move(*slot);
+        std::destroy_at(slot);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    // * 批次取出最多max_count個元素寫到out，回傳實際取出的個數；整批只發佈一次head_。
+    template<typename OutputIt>
+    std::size_t PopBatch(OutputIt out, std::size_t max_count) {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        if(cached_tail_ - head < max_count) cached_tail_ = tail_.load(std::memory_order_acquire);
+        std::size_t n = std::min(max_count, cached_tail_ - head);
+        for(std::size_t i = 0; i < n; i++, ++out) {
+            T* slot = slots_[(head + i) & kMask].Get();
+            *out = std::move(*slot);
+            std::destroy_at(slot);
+        }
+        if(n) head_.store(head + n, std::memory_order_release);
+        return n;
+    }
+    // * 其他執行緒同時操作時只是當下的近似值。
+    std::size_t Size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+    bool Empty() const {
+        return Size() == 0;
+    }
+    static constexpr std::size_t Capacity() {
+        return N;
+    }
+  private:
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};  // * 消費者寫。
+    alignas(kCacheLine) std::size_t cached_tail_{0};        // * 消費者私有。
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};  // * 生產者寫。
+    alignas(kCacheLine) std::size_t cached_head_{0};        // * 生產者私有。
+    alignas(kCacheLine) RingSlot<T> slots_[N];
+};
+
+// * MpmcRing: 多生產者、多消費者(multi-producer multi-consumer)的環狀佇列(Dmitry Vyukov的有界佇列)。
+//   每個位置帶一個序號seq：seq == pos表示位置pos可以寫入，seq == pos + 1表示已經寫好可以讀取，
+//   讀完後設為pos + N留給下一輪的寫入。生產者/消費者只需以一次CAS搶下enqueue_/dequeue_的位置，
+//   之後各自在自己的位置上建構/取出元素，不同位置的操作完全平行，也不需要mutex。
+//   每個位置各佔一條cache line，相鄰位置的生產者與消費者不會互相干擾。
+template<typename T, std::size_t N>
+class MpmcRing{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "MpmcRing capacity must be a power of two");
+    static constexpr std::size_t kMask = N - 1;
+  public:
+    MpmcRing() {
+        for(std::size_t i = 0; i < N; i++) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+    MpmcRing(const MpmcRing&) = delete;
+    MpmcRing& operator=(const MpmcRing&) = delete;
+    ~MpmcRing() {
+        std::size_t pos = dequeue_.load(std::memory_order_relaxed);
+        std::size_t end = enqueue_.load(std::memory_order_relaxed);
+        for(; pos != end; pos++) {
+            std::destroy_at(cells_[pos & kMask].slot.Get());
+        }
+    }
+    // * 可以從任意多個執行緒同時呼叫；已滿時回傳false，不會等待。
+    bool TryPush(const T& val) {
+        return TryEmplace(val);
+    }
+    bool TryPush(T&& val) {
+        return TryEmplace(std::move(val));
+    }
+    // * 搶下位置之後建構失敗的話該位置永遠不會發佈，消費者會卡住；因此可能拋出例外的建構先在外面完成，
+    //   搶下位置之後只做不會拋出例外的移動建構。
+    template<typename... Args>
+    bool TryEmplace(Args&&... args) {
+        static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcRing needs a nothrow move constructor");
+        if constexpr(!std::is_nothrow_constructible_v<T, Args&&...>) {
+            return TryEmplace(T(std::forward<Args>(args)...));
+        }
+        std::size_t pos = enqueue_.load(std::memory_order_relaxed);
+        for(;;) {
+            Cell& cell = cells_[pos & kMask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+            if(diff == 0) {
+                if(enqueue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    new (cell.slot.bytes) T(std::forward<Args>(args)...);
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                return false;                   // * 這個位置上一輪的元素還沒被取走：已滿。
+            } else {
+                pos = enqueue_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // * 可以從任意多個執行緒同時呼叫；已空時回傳false，不會等待。
+    bool TryPop(T& out) {
+        std::size_t pos = dequeue_.load(std::memory_order_relaxed);
+        for(;;) {
+            Cell& cell = cells_[pos & kMask];
+            std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+            if(diff == 0) {
+                if(dequeue_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    T* val = cell.slot.Get();
+                    out = std::move(*val);
+                    std::destroy_at(val);
+                    cell.seq.store(pos + N, std::memory_order_release);
+                    return true;
+                }
+            } else if(diff < 0) {
+                return false;                   // * 這個位置還沒被寫入：已空。
+            } else {
+                pos = dequeue_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // * 批次操作：多個生產者/消費者交錯時無法保證一段連續的位置，因此逐一搶位置，遇到已滿/已空就停止；
+    //   回傳實際放入/取出的個數。PopBatch需要T可以預設建構。
+    template<typename InputIt>
+    std::size_t PushBatch(InputIt first, std::size_t count) {
+        std::size_t n = 0;
+        for(; n < count && TryPush(*first); n++) {
+            ++first;
+        }
+        return n;
+    }
+    template<typename OutputIt>
+    std::size_t PopBatch(OutputIt out, std::size_t max_count) {
+        std::size_t n = 0;
+        T val;
+        for(; n < max_count && TryPop(val); n++, ++out) {
+            *out = std::move(val);
+        }
+        return n;
+    }
+    std::size_t Size() const {
+        std::size_t end = enqueue_.load(std::memory_order_acquire);
+        std::size_t pos = dequeue_.load(std::memory_order_acquire);
+        return end > pos ? end - pos : 0;
+    }
+    bool Empty() const {
+        return Size() == 0;
+    }
+    static constexpr std::size_t Capacity() {
+        return N;
+    }
+  private:
+    struct alignas(kCacheLine) Cell{
+        std::atomic<std::size_t> seq;
+        RingSlot<T> slot;
+    };
+    alignas(kCacheLine) std::atomic<std::size_t> enqueue_{0};
+    alignas(kCacheLine) std::atomic<std::size_t> dequeue_{0};
+    alignas(kCacheLine) Cell cells_[N];
+};
+}
+
+int main() {
+    // * 一個生產者把0..99999交給一個消費者；佇列只有1024格，兩邊以TryPush/TryPop輪詢。
+    auto spsc = std::make_unique<STD::SpscRing<int, 1024>>();
+    std::thread producer([&spsc] {
+        for(int i = 0; i < 100000; i++) {
+            while(!spsc->TryPush(i)) {
+                std::this_thread::yield();      // * 核心不足時讓出CPU給消費者；綁定在不同核心上時可以直接自旋。
+            }
+        }
+    });
+    long long sum = 0;
+    bool ordered = true;
+    for(int expect = 0; expect < 100000;) {
+        int val;
+        if(spsc->TryPop(val)) {
+            ordered = ordered && val == expect;
+            sum += val;
+            expect++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    std::cout << sum << " " << ordered << " " << spsc->Empty() << std::endl;  // 4999950000 1 1
+
+    STD::SpscRing<std::string, 4> words;
+    std::string batch[] = {"a", "b", "c", "d", "e"};
+    std::cout << words.PushBatch(batch, 5) << " " << words.TryPush("f") << std::endl; // 4 0 (只放得下4個)
+    std::vector<std::string> got(3);
+    std::cout << words.PopBatch(got.begin(), 3) << " " << got[2] << " " << words.Size() << std::endl; // 3 c 1
+
+    // * 四個生產者、四個消費者同時操作同一個佇列。
+    auto mpmc = std::make_unique<STD::MpmcRing<long long, 256>>();
+    std::atomic<long long> total{0};
+    std::atomic<int> consumed{0};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; t++) {
+        threads.emplace_back([&mpmc, t] {
+            for(int i = 1; i <= 25000; i++) {
+                while(!mpmc->TryPush(t * 25000LL + i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+        threads.emplace_back([&] {
+            long long val;
+            while(consumed.load(std::memory_order_relaxed) < 100000) {
+                if(mpmc->TryPop(val)) {
+                    total += val;
+                    consumed++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for(std::thread& thread: threads) {
+        thread.join();
+    }
+    std::cout << consumed << " " << total << " " << mpmc->Size() << std::endl; // 100000 5000050000 0
+
+    STD::MpmcRing<std::string, 2> pair;
+    pair.TryEmplace(3, 'z');
+    pair.TryPush("ring");
+    std::string out;
+    std::cout << pair.TryPush("full") << " " << pair.TryPop(out) << " " << out << std::endl; // 0 1 zzz
+    return 0;
+}
\ No newline at end of file
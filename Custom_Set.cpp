@@ -2,6 +2,8 @@
 #include <vector>
 #include <forward_list>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 
 namespace STD{
 // * Generic Algorithm
@@ -14,39 +16,43 @@ Iterator Find(const Iterator& begin, const Iterator& end, const T& val) {
 }
 // * Complex Data Structure: A vector of (forward, singly linked) list.
 //   Primary: std::vector, Secondary: std::forward_list.
-template<typename T>
+// * Allocator: 同時用於bucket陣列與每個bucket的節點。例如傳入std::pmr::polymorphic_allocator<T>並指向一個
+//   monotonic_buffer_resource，整個Set(包含所有節點)都從同一塊arena配置，最後隨著arena一次釋放。
+template<typename T, typename Allocator = std::allocator<T>>
 class Set{
   public:
-    using ListIterator = typename std::forward_list<T>::iterator;
-    Set(): data_(6) {}
+    using Bucket = std::forward_list<T, Allocator>;
+    using Table = std::vector<Bucket, typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>>;
+    using ListIterator = typename Bucket::iterator;
+    explicit Set(const Allocator& alloc = Allocator()): data_(6, Bucket(alloc), typename Table::allocator_type(alloc)) {}
     std::size_t Hash(const T& val) {
         std::hash<T> hasher;
         return (hasher(val) + data_.size()) % data_.size();
     }
     bool Contains(const T& val) {
         std::size_t bucketid = Hash(val);
-        std::forward_list<T>& bucket = data_[bucketid];
+        Bucket& bucket = data_[bucketid];
         ListIterator it = Find(std::begin(bucket), std::end(bucket), val);
         return it != std::end(bucket);
     }
     void Insert(const T& val) {
         if(!Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<T>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.push_front(val);
         }
     }
     void Insert(T&& val) {
         if(!Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<T>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.push_front(std::move(val));
         }
     }
     void Erase(const T& val) {
         if(Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<T>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.remove(val);
         }
     }
@@ -82,12 +88,12 @@ class Set{
       private:
         Iterator(
             const int& index,
-            const std::vector<std::forward_list<T>>& data,
-            const typename std::forward_list<T>::const_iterator& iterator
+            const Table& data,
+            const typename Bucket::const_iterator& iterator
         ): index_(index), data_(data), iterator_(iterator) {}
         int index_;
-        const std::vector<std::forward_list<T>> data_;
-        typename std::forward_list<T>::const_iterator iterator_;
+        const Table& data_;
+        typename Bucket::const_iterator iterator_;
     };
     Iterator Begin() const {
         int id = 0;
@@ -115,47 +121,49 @@ class Set{
         // }
     }
   private:
-    std::vector<std::forward_list<T>> data_;
+    Table data_;
 };
 // * Template Specialization (for int)
-template<>
-class Set<int>{
+template<typename Allocator>
+class Set<int, Allocator>{
   public:
-    using ListIterator = typename std::forward_list<int>::iterator;
-    Set(): data_(6) {}
+    using Bucket = std::forward_list<int, Allocator>;
+    using Table = std::vector<Bucket, typename std::allocator_traits<Allocator>::template rebind_alloc<Bucket>>;
+    using ListIterator = typename Bucket::iterator;
+    explicit Set(const Allocator& alloc = Allocator()): data_(6, Bucket(alloc), typename Table::allocator_type(alloc)) {}
     std::size_t Hash(const int& val) {
         int n = data_.size();
         return (val % n + n) % n;
     }
     bool Contains(const int& val) {
         std::size_t bucketid = Hash(val);
-        std::forward_list<int>& bucket = data_[bucketid];
+        Bucket& bucket = data_[bucketid];
         ListIterator it = Find(std::begin(bucket), std::end(bucket), val);
         return it != std::end(bucket);
     }
     void Insert(const int& val) {
         if(!Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<int>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.push_front(val);
         }
     }
     void Insert(int&& val) {
         if(!Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<int>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.push_front(std::move(val));
         }
     }
     void Erase(const int& val) {
         if(Contains(val)) {
             std::size_t bucketid = Hash(val);
-            std::forward_list<int>& bucket = data_[bucketid];
+            Bucket& bucket = data_[bucketid];
             bucket.remove(val);
         }
     }
     class Iterator{
-        friend class Set<int>;
+        friend class Set<int, Allocator>;
       public:
         bool operator==(const Iterator& other) const {
             return iterator_ == other.iterator_;
@@ -186,12 +194,12 @@ class Set<int>{
       private:
         Iterator(
             const int& index,
-            const std::vector<std::forward_list<int>>& data,
-            const typename std::forward_list<int>::const_iterator& iterator
+            const Table& data,
+            const typename Bucket::const_iterator& iterator
         ): index_(index), data_(data), iterator_(iterator) {}
         int index_;
-        const std::vector<std::forward_list<int>>& data_;
-        typename std::forward_list<int>::const_iterator iterator_;
+        const Table& data_;
+        typename Bucket::const_iterator iterator_;
     };
     Iterator Begin() const {
         int id = 0;
@@ -219,7 +227,7 @@ class Set<int>{
         // }
     }
   private:
-    std::vector<std::forward_list<int>> data_;
+    Table data_;
 };
 template<typename Container>
 typename Container::Iterator Begin(const Container& con) {
@@ -286,6 +294,20 @@ int main() {
     std::cout << std::endl;
     sos.Clear();
     STD::Print(sos);
+    std::cout << std::endl;
+
+    std::cout << "============================" << std::endl;
+    {
+        // * bucket陣列與所有節點都從同一塊arena配置，離開scope時一次釋放。
+        std::pmr::monotonic_buffer_resource arena;
+        STD::Set<int, std::pmr::polymorphic_allocator<int>> pset(&arena);
+        for(int i = 0; i < 4; i++) {
+            pset.Insert(i * 3);
+        }
+        pset.Erase(3);
+        STD::Print(pset);
+        std::cout << std::endl;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -1,4 +1,7 @@
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
 namespace STD{
 template<typename T>
 struct ListNode{
@@ -6,27 +9,34 @@ struct ListNode{
     ListNode* next{};
 };
 
-template<typename T>
+// * Allocator: 節點的配置器(介面與標準容器相同)，內部會rebind成ListNode<T>的配置器。
+//   例如傳入std::pmr::polymorphic_allocator<T>並指向一個monotonic_buffer_resource，所有節點就都從同一塊arena配置。
+template<typename T, typename Allocator = std::allocator<T>>
 class ForwardList{
+    using NodeAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<ListNode<T>>;
+    using NodeAllocTraits = std::allocator_traits<NodeAlloc>;
   public:
-    template<typename U> friend std::ostream& operator<<(std::ostream& os, const ForwardList<U>& lst);
+    template<typename U, typename A> friend std::ostream& operator<<(std::ostream& os, const ForwardList<U, A>& lst);
     ForwardList() = default;
-    ForwardList(const std::initializer_list<T>& lst) {
+    explicit ForwardList(const Allocator& alloc): alloc_(alloc) {}
+    ForwardList(const std::initializer_list<T>& lst, const Allocator& alloc = Allocator()): alloc_(alloc) {
         ListNode<T> tmp {};
         ListNode<T>* cur;
         cur = &tmp;
         for(const T& ele: lst) {
-            cur->next = new ListNode<T> {ele, nullptr};
+            cur->next = NewNode(ele, nullptr);
             cur = cur->next;
             size_++;
         }
         Data = tmp.next;
     }
-    ForwardList(const ForwardList& lst) {
+    ForwardList(const ForwardList& lst)
+        : ForwardList(lst, NodeAllocTraits::select_on_container_copy_construction(lst.alloc_)) {}
+    ForwardList(const ForwardList& lst, const Allocator& alloc): alloc_(alloc) {
         ListNode<T> tmp {};
         ListNode<T>* cur = &tmp;
         for(ListNode<T>* src = lst.Data; src != nullptr; src = src->next) {
-            cur->next = new ListNode<T> {src->val, nullptr};
+            cur->next = NewNode(src->val, nullptr);
             cur = cur->next;
             size_++;
         }
@@ -34,12 +44,16 @@ class ForwardList{
     }
     ForwardList& operator=(const ForwardList& lst) {
         if(&lst == this) return *this;
-        ForwardList tmp = lst;
+        // * 暫存物件使用交換後*this應持有的配置器，交換節點之後每個節點仍然由配置它的配置器釋放。
+        ForwardList tmp(lst, NodeAllocTraits::propagate_on_container_copy_assignment::value ? lst.alloc_ : alloc_);
         std::swap(Data, tmp.Data);
         std::swap(size_, tmp.size_);
+        if constexpr(NodeAllocTraits::propagate_on_container_copy_assignment::value) {
+            std::swap(alloc_, tmp.alloc_);
+        }
         return *this;
     }
-    ForwardList(ForwardList&& lst) {
+    ForwardList(ForwardList&& lst): alloc_(std::move(lst.alloc_)) {
         Data = lst.Data;
         size_ = lst.size_;
         lst.Data = nullptr;
@@ -47,19 +61,32 @@ class ForwardList{
     }
     ForwardList& operator=(ForwardList&& lst) {
         if(&lst == this) return *this;
-        ForwardList tmp = std::move(lst);
-        std::swap(Data, tmp.Data);
-        std::swap(size_, tmp.size_);
+        Clear();
+        if constexpr(NodeAllocTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(lst.alloc_);
+        }
+        if(alloc_ == lst.alloc_) {
+            std::swap(Data, lst.Data);
+            std::swap(size_, lst.size_);
+        } else {                                // * 兩邊的配置器不相等時不能接手對方的節點，只能以自己的配置器逐一複製。
+            ForwardList tmp(lst, alloc_);
+            std::swap(Data, tmp.Data);
+            std::swap(size_, tmp.size_);
+            lst.Clear();
+        }
         return *this;
     }
     ~ForwardList() {
+        Clear();
+    }
+    void Clear() {
         while(!IsEmpty()) {
             PopFront();
         }
     }
-    T& operator[](int id) {
+    T& operator[](std::size_t id) {
         ListNode<T>* cur = Data;
-        int i = 0;
+        std::size_t i = 0;
         // if(!IsEmpty()) {
         while(id != i) {
             cur = cur->next;
@@ -68,9 +95,9 @@ class ForwardList{
         return cur->val;
         // }
     }
-    const T& operator[](int id) const {
+    const T& operator[](std::size_t id) const {
         ListNode<T>* cur = Data;
-        int i = 0;
+        std::size_t i = 0;
         // if(!IsEmpty()) {
         while(id != i) {
             cur = cur->next;
@@ -91,7 +118,7 @@ class ForwardList{
     const T& Back() const {
         return (*this)[size_-1];
     }
-    int Size() const {
+    std::size_t Size() const {
         return size_;
     }
     bool IsEmpty() {
@@ -103,29 +130,30 @@ class ForwardList{
             while(cur->next) {
                 cur = cur->next;
             }
-            cur->next = new ListNode<T> {val, nullptr};
+            cur->next = NewNode(val, nullptr);
         } else {
-            Data = new ListNode<T> {val, nullptr};
+            Data = NewNode(val, nullptr);
         }
         size_++;
     }
     void PushFront(const T& val) {
-        Data = new ListNode<T> {val, Data};
+        Data = NewNode(val, Data);
         size_++;
     }
     void PopBack() {
         if(!IsEmpty()) {
             ListNode<T>* cur = Data;
-            ListNode<T>* pre;
-            if(!cur->next) {
-                Data = nullptr;
-            }
+            ListNode<T>* pre = nullptr;
             while(cur->next) {
                 pre = cur;
                 cur = cur->next;
             }
-            pre->next = nullptr;
-            delete cur;
+            if(pre) {
+                pre->next = nullptr;
+            } else {
+                Data = nullptr;
+            }
+            DeleteNode(cur);
             size_--;
         }
     }
@@ -134,7 +162,7 @@ class ForwardList{
             ListNode<T>* tmp;
             tmp = Data;
             Data = Data->next;
-            delete tmp;
+            DeleteNode(tmp);
             size_--;
         }
     }
@@ -162,21 +190,36 @@ class ForwardList{
         return nullptr;
     }
   private:
+    ListNode<T>* NewNode(const T& val, ListNode<T>* next) {
+        ListNode<T>* node = NodeAllocTraits::allocate(alloc_, 1);
+        try {
+            new (node) ListNode<T> {val, next};
+        } catch(...) {
+            NodeAllocTraits::deallocate(alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+    void DeleteNode(ListNode<T>* node) {
+        node->~ListNode<T>();
+        NodeAllocTraits::deallocate(alloc_, node, 1);
+    }
     ListNode<T>* Data{};
-    int size_{};
+    std::size_t size_{};
+    NodeAlloc alloc_{};
 };
 
-template<typename T>
-typename ForwardList<T>::Iterator Begin(const ForwardList<T>& lst) {
+template<typename T, typename Allocator>
+typename ForwardList<T, Allocator>::Iterator Begin(const ForwardList<T, Allocator>& lst) {
     return lst.Begin();
 }
-template<typename T>
-typename ForwardList<T>::Iterator End(const ForwardList<T>& lst) {
+template<typename T, typename Allocator>
+typename ForwardList<T, Allocator>::Iterator End(const ForwardList<T, Allocator>& lst) {
     return lst.End();
 }
 
-template<typename T>
-std::ostream& operator<<(std::ostream& os, const ForwardList<T>& lst) {
+template<typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& os, const ForwardList<T, Allocator>& lst) {
     os << "[";
     for(auto cur = lst.Begin(); cur != lst.End(); cur++) {
         if(cur != lst.Begin()) os << ", ";
@@ -246,5 +289,16 @@ int main() {
     std::cout << ll3 << std::endl;  // []
     std::cout << ll4 << std::endl;  // [12, 34, 56, 888, 90]
 
+    /* 以monotonic arena配置節點：個別節點的釋放都是no-op，離開scope時arena一次釋放全部記憶體 */
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        STD::ForwardList<int, std::pmr::polymorphic_allocator<int>> pl({1, 2, 3}, &arena);
+        pl.PushFront(0);
+        pl.PushBack(4);
+        STD::ForwardList<int, std::pmr::polymorphic_allocator<int>> pl2(&arena);
+        pl2 = pl;
+        std::cout << pl2 << std::endl;  // [0, 1, 2, 3, 4]
+    }
+
     return 0;
 }
\ No newline at end of file
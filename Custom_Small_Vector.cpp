@@ -0,0 +1,262 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <algorithm>
+namespace STD{
+// * SmallVector: 與Vector相同的介面，但物件本身內嵌一塊可放N個元素的未初始化空間(inline storage)。
+//   元素數量不超過N時完全不需要向heap配置記憶體，超過時才把元素搬到heap上(spill)，之後的行為就和Vector一樣。
+template<typename T, int N>
+class SmallVector{
+    static_assert(N > 0, "SmallVector needs room for at least one inline element");
+    template<typename U, int UN> friend std::ostream& operator<<(std::ostream& os, const SmallVector<U, UN>& vec);
+  public:
+    SmallVector() = default;
+    SmallVector(int size) {
+        Resize(size);
+    }
+    SmallVector(const std::initializer_list<T> lst) {
+        Reserve(lst.size());
+        std::uninitialized_copy(lst.begin(), lst.end(), data_);
+        size_ = lst.size();
+    }
+    SmallVector(const SmallVector& other) {
+        Reserve(other.size_);
+        std::uninitialized_copy(other.data_, other.data_ + other.size_, data_);
+        size_ = other.size_;
+    }
+    SmallVector& operator=(const SmallVector& other) {
+        if(&other == this) return *this;
+        SmallVector tmp = other;
+        Swap(tmp);
+        return *this;
+    }
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        StealFrom(other);
+    }
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if(&other == this) return *this;
+        Clear();
+        if(!IsInline()) {
+            Deallocate(data_, capacity_);
+            data_ = InlineData();
+            capacity_ = N;
+        }
+        StealFrom(other);
+        return *this;
+    }
+    ~SmallVector() {
+        Clear();
+        if(!IsInline()) Deallocate(data_, capacity_);
+    }
+    T& operator[](int id) {
+        return data_[id];
+    }
+    const T& operator[](int id) const {
+        return data_[id];
+    }
+    int Size() const {
+        return size_;
+    }
+    int Capacity() const {
+        return capacity_;
+    }
+    bool IsInline() const {
+        return data_ == InlineData();
+    }
+    void Resize(int new_size) {
+        if(new_size > capacity_) {
+            Reserve(2*(new_size+1));
+        }
+        if(new_size > size_) {
+            std::uninitialized_value_construct(data_ + size_, data_ + new_size);
+        }
+        std::destroy(data_ + std::min(new_size, size_), data_ + size_);
+        size_ = new_size;
+    }
+    void Clear() {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+    void PushBack(const T& val) {
+        EmplaceBack(val);
+    }
+    void PushBack(T&& val) {
+        EmplaceBack(std::move(val));
+    }
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if(size_ == capacity_) {
+            T val(std::forward<Args>(args)...);  // * 先建構出新元素，搬移到heap之後args可能參考到已失效的舊位址。
+            Reserve(2*(size_+1));
+            new (data_ + size_) T(std::move(val));
+        } else {
+            new (data_ + size_) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+    void PopBack() {
+        if(!Empty()) {
+            data_[size_-1].~T();
+            size_--;
+        }
+    }
+    T& Back() {
+        return data_[size_-1];
+    }
+    const T& Back() const {
+        return data_[size_-1];
+    }
+    T& Front() {
+        return data_[0];
+    }
+    const T& Front() const {
+        return data_[0];
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    void Fill(const T& val) {
+        for(int i = 0; i < size_; i++) {
+            data_[i] = val;
+        }
+    }
+    void Swap(SmallVector& other) {
+        if(!IsInline() && !other.IsInline()) {  // * 兩邊都在heap上時只需交換指標，與Vector相同。
+            std::swap(other.data_, data_);
+            std::swap(other.size_, size_);
+            std::swap(other.capacity_, capacity_);
+            return;
+        }
+        SmallVector tmp = std::move(other);     // * 有一邊使用內嵌空間時，元素必須實際搬移。
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+    class ConstIterator{
+      public:
+        ConstIterator(const T* ptr): ptr_(ptr) {}
+        bool operator!=(const ConstIterator& other) {
+            return ptr_ != other.ptr_;
+        }
+        const T& operator*() {
+            return *ptr_;
+        }
+        const T* operator++(int) {
+            return ptr_++;
+        }
+      private:
+        const T* ptr_;
+    };
+    ConstIterator Begin() const {
+        return {data_};
+    }
+    ConstIterator End() const {
+        return {data_ + size_};
+    }
+  private:
+    T* InlineData() {
+        return reinterpret_cast<T*>(inline_);
+    }
+    const T* InlineData() const {
+        return reinterpret_cast<const T*>(inline_);
+    }
+    // * heap緩衝區與Vector一樣透過std::allocator配置，alignof(T)超過new的預設對齊(例如alignas(64)的型別)時也會正確對齊，
+    //   與內嵌空間的alignas(T)一致。
+    static T* Allocate(int n) {
+        return std::allocator<T>().allocate(n);
+    }
+    static void Deallocate(T* ptr, int n) {
+        std::allocator<T>().deallocate(ptr, n);
+    }
+    // * 確保容量至少為new_capacity，必要時把元素搬到新的heap緩衝區(move_if_noexcept)。
+    void Reserve(int new_capacity) {
+        if(new_capacity <= capacity_) return;
+        T* tmp = Allocate(new_capacity);
+        try {
+            if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                std::uninitialized_move(data_, data_ + size_, tmp);
+            } else {
+                std::uninitialized_copy(data_, data_ + size_, tmp);
+            }
+        } catch(...) {
+            Deallocate(tmp, new_capacity);
+            throw;
+        }
+        std::destroy(data_, data_ + size_);
+        if(!IsInline()) Deallocate(data_, capacity_);
+        data_ = tmp;
+        capacity_ = new_capacity;
+    }
+    // * 取走other的元素：other在heap上時直接接手指標，在內嵌空間時只能逐一移動建構。呼叫前*this必須是空的內嵌狀態。
+    void StealFrom(SmallVector& other) {
+        if(other.IsInline()) {
+            std::uninitialized_move(other.data_, other.data_ + other.size_, data_);
+            size_ = other.size_;
+            other.Clear();
+        } else {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.InlineData();
+            other.size_ = 0;
+            other.capacity_ = N;
+        }
+    }
+    alignas(T) unsigned char inline_[sizeof(T) * N];
+    T* data_{InlineData()};
+    int size_{};
+    int capacity_{N};
+};
+
+template<typename T, int N>
+typename SmallVector<T, N>::ConstIterator Begin(const SmallVector<T, N>& vec) {
+    return vec.Begin();
+}
+template<typename T, int N>
+typename SmallVector<T, N>::ConstIterator End(const SmallVector<T, N>& vec) {
+    return vec.End();
+}
+
+template<typename T, int N>
+std::ostream& operator<<(std::ostream& os, const SmallVector<T, N>& vec) {
+    os << "[";
+    for(typename SmallVector<T, N>::ConstIterator it = Begin(vec); it != End(vec); it++) {
+        if(it != Begin(vec)) os << ", ";
+        os << *it;
+    }
+    os << "]";
+    return os;
+}
+}
+
+int main() {
+    STD::SmallVector<int, 8> v {1, 2, 3};
+    std::cout << v << std::endl;                          // [1, 2, 3]
+    std::cout << std::boolalpha << v.IsInline() << std::endl; // true
+    for(int i = 4; i <= 8; i++) {
+        v.PushBack(i);
+    }
+    std::cout << v.IsInline() << std::endl;               // true
+    v.PushBack(9);                                        // * 第9個元素超過內嵌容量，搬到heap上。
+    std::cout << v.IsInline() << std::endl;               // false
+    std::cout << v << std::endl;                          // [1, 2, 3, 4, 5, 6, 7, 8, 9]
+    v.Resize(3);
+    v.Fill(7);
+    std::cout << v << std::endl;                          // [7, 7, 7]
+
+    STD::SmallVector<std::string, 2> a {"I", "am"};
+    STD::SmallVector<std::string, 2> b;
+    b.EmplaceBack(3, 'z');
+    a.Swap(b);
+    std::cout << a << std::endl;                          // [zzz]
+    std::cout << b << std::endl;                          // [I, am]
+    b.PushBack(b[0]);
+    std::cout << b << std::endl;                          // [I, am, I]
+    STD::SmallVector<std::string, 2> c = std::move(b);
+    std::cout << b << std::endl;                          // []
+    std::cout << c << std::endl;                          // [I, am, I]
+    c = a;
+    std::cout << c << std::endl;                          // [zzz]
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,314 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <numeric>
+#include <cstddef>
+#include <cstring>
+namespace STD{
+// * Span: 指向一段連續元素的非擁有(non-owning)視圖，SoAVector以它交出單一欄位的整個column。
+template<typename T>
+class Span{
+  public:
+    Span(T* data, std::size_t size): data_(data), size_(size) {}
+    T& operator[](std::size_t id) const {
+        return data_[id];
+    }
+    T* Data() const {
+        return data_;
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    T* begin() const {
+        return data_;
+    }
+    T* end() const {
+        return data_ + size_;
+    }
+  private:
+    T* data_;
+    std::size_t size_;
+};
+
+// * SoAVector: struct-of-arrays容器。概念上存放的是(Fields...)組成的一列列紀錄，但每個欄位各自放在一塊連續的
+//   column中，而不是把整筆紀錄放在一起(array-of-structs，例如Vector<Record>)。只讀取某個欄位的迴圈因此只會
+//   把該欄位的位元組載入cache，而且column是單純的連續陣列，編譯器可以直接向量化。
+//   所有column共用同一個size_與capacity_，重新配置時一起成長。
+template<typename... Fields>
+class SoAVector{
+    static_assert(sizeof...(Fields) > 0, "SoAVector needs at least one field");
+    using Columns = std::tuple<Fields*...>;
+  public:
+    template<std::size_t I>
+    using Field = std::tuple_element_t<I, std::tuple<Fields...>>;
+    using Value = std::tuple<Fields...>;
+    // * 列代理(row proxy)：每個欄位的參考組成的tuple，可以用structured binding拆開，也可以整列賦值。
+    using Row = std::tuple<Fields&...>;
+    using ConstRow = std::tuple<const Fields&...>;
+    SoAVector() = default;
+    SoAVector(const SoAVector& other) {
+        Reserve(other.size_);
+        for(std::size_t i = 0; i < other.size_; i++) {
+            PushBack(other[i]);
+        }
+    }
+    SoAVector& operator=(const SoAVector& other) {
+        if(&other == this) return *this;
+        SoAVector tmp = other;
+        Swap(tmp);
+        return *this;
+    }
+    SoAVector(SoAVector&& other) noexcept {
+        Swap(other);
+    }
+    SoAVector& operator=(SoAVector&& other) noexcept {
+        if(&other == this) return *this;
+        SoAVector tmp = std::move(other);
+        Swap(tmp);
+        return *this;
+    }
+    ~SoAVector() {
+        Clear();
+        ForEachColumn([&](auto index) {
+            constexpr std::size_t I = decltype(index)::value;
+            if(std::get<I>(columns_)) std::allocator<Field<I>>().deallocate(std::get<I>(columns_), capacity_);
+        });
+    }
+    Row operator[](std::size_t id) {
+        return RowAt(id, std::index_sequence_for<Fields...>{});
+    }
+    ConstRow operator[](std::size_t id) const {
+        return RowAt(id, std::index_sequence_for<Fields...>{});
+    }
+    // * 第id列的第I個欄位。
+    template<std::size_t I>
+    Field<I>& Get(std::size_t id) {
+        return std::get<I>(columns_)[id];
+    }
+    template<std::size_t I>
+    const Field<I>& Get(std::size_t id) const {
+        return std::get<I>(columns_)[id];
+    }
+    // * 第I個欄位的整個column，例如std::accumulate(soa.Column<2>().begin(), soa.Column<2>().end(), 0.0)。
+    template<std::size_t I>
+    Span<Field<I>> Column() {
+        return {std::get<I>(columns_), size_};
+    }
+    template<std::size_t I>
+    Span<const Field<I>> Column() const {
+        return {std::get<I>(columns_), size_};
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    std::size_t Capacity() const {
+        return capacity_;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    void Reserve(std::size_t new_capacity) {
+        if(new_capacity > capacity_) Reallocate(new_capacity);
+    }
+    void Resize(std::size_t new_size) {
+        Reserve(new_size);
+        while(size_ < new_size) {
+            ConstructRow(size_, [](auto, auto* ptr) {
+                using F = std::remove_pointer_t<decltype(ptr)>;
+                new (ptr) F();
+            });
+            size_++;
+        }
+        while(size_ > new_size) {
+            PopBack();
+        }
+    }
+    void Clear() {
+        while(!Empty()) {
+            PopBack();
+        }
+    }
+    void PushBack(const Value& row) {
+        EmplaceTuple(row);
+    }
+    // * 傳入列代理(例如soa.PushBack(soa[0]))時會先轉成Value的暫存物件，因此參考到自身元素也沒關係。
+    void PushBack(Value&& row) {
+        EmplaceTuple(std::move(row));
+    }
+    // * 每個欄位各給一個建構引數。
+    template<typename... Args, typename = std::enable_if_t<sizeof...(Args) == sizeof...(Fields)>>
+    void EmplaceBack(Args&&... args) {
+        EmplaceTuple(std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    void PopBack() {
+        if(Empty()) return;
+        size_--;
+        ForEachColumn([&](auto index) {
+            constexpr std::size_t I = decltype(index)::value;
+            std::destroy_at(std::get<I>(columns_) + size_);
+        });
+    }
+    void Swap(SoAVector& other) {
+        std::swap(other.columns_, columns_);
+        std::swap(other.size_, size_);
+        std::swap(other.capacity_, capacity_);
+    }
+  private:
+    template<typename F>
+    static void ForEachColumn(F&& f) {
+        ForEachColumn(std::forward<F>(f), std::index_sequence_for<Fields...>{});
+    }
+    template<typename F, std::size_t... I>
+    static void ForEachColumn(F&& f, std::index_sequence<I...>) {
+        (f(std::integral_constant<std::size_t, I>{}), ...);
+    }
+    template<std::size_t... I>
+    Row RowAt(std::size_t id, std::index_sequence<I...>) {
+        return Row(std::get<I>(columns_)[id]...);
+    }
+    template<std::size_t... I>
+    ConstRow RowAt(std::size_t id, std::index_sequence<I...>) const {
+        return ConstRow(std::get<I>(columns_)[id]...);
+    }
+    // * 在第id列的每個column上以make(index, ptr)建構欄位；某個欄位拋出例外時，已建構的欄位會被解構，該列維持未初始化。
+    template<typename Make>
+    void ConstructRow(std::size_t id, Make&& make) {
+        std::size_t built = 0;
+        try {
+            ForEachColumn([&](auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                make(index, std::get<I>(columns_) + id);
+                built++;
+            });
+        } catch(...) {
+            ForEachColumn([&](auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                if(I < built) std::destroy_at(std::get<I>(columns_) + id);
+            });
+            throw;
+        }
+    }
+    template<typename Tuple>
+    void EmplaceTuple(Tuple&& row) {
+        if(size_ == capacity_) {
+            Value tmp(std::forward<Tuple>(row)); // * 先建構出新列，重新配置之後EmplaceBack的引數可能參考到已失效的舊位址。
+            Reallocate(2*(size_+1));
+            ConstructRow(size_, [&](auto index, auto* ptr) {
+                using F = std::remove_pointer_t<decltype(ptr)>;
+                new (ptr) F(std::get<decltype(index)::value>(std::move(tmp)));
+            });
+        } else {
+            ConstructRow(size_, [&](auto index, auto* ptr) {
+                using F = std::remove_pointer_t<decltype(ptr)>;
+                new (ptr) F(std::get<decltype(index)::value>(std::forward<Tuple>(row)));
+            });
+        }
+        size_++;
+    }
+    // * 所有欄位都能不拋出例外地搬移時，每個column都用move；只要有一個欄位的移動可能拋出例外，所有column都改用copy，
+    //   否則前面的column已經被move走、後面的column才拋出例外時，原本的資料就回不去了。
+    static constexpr bool kMoveColumns = ((std::is_trivially_copyable_v<Fields> || std::is_nothrow_move_constructible_v<Fields>) && ...);
+    // * trivially copyable的欄位直接memcpy；不能copy的欄位只能move，此時只提供基本的例外保證。
+    template<typename F>
+    static void Relocate(F* src, std::size_t n, F* dst) {
+        if constexpr(std::is_trivially_copyable_v<F>) {
+            if(n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(F) * n);
+        } else if constexpr(kMoveColumns || !std::is_copy_constructible_v<F>) {
+            std::uninitialized_move(src, src + n, dst);
+        } else {
+            std::uninitialized_copy(src, src + n, dst);
+        }
+    }
+    // * 先配置好所有欄位的新column，配置失敗時還沒有任何元素被搬動；再逐一搬入元素，
+    //   途中拋出例外時已建構的元素解構、新column全部釋放，原本的column維持完整。
+    void Reallocate(std::size_t new_capacity) {
+        Columns tmp{};
+        std::size_t allocated = 0;
+        std::size_t relocated = 0;
+        try {
+            ForEachColumn([&](auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                std::get<I>(tmp) = std::allocator<Field<I>>().allocate(new_capacity);
+                allocated++;
+            });
+            ForEachColumn([&](auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                Relocate(std::get<I>(columns_), size_, std::get<I>(tmp));
+                relocated++;
+            });
+        } catch(...) {
+            ForEachColumn([&](auto index) {
+                constexpr std::size_t I = decltype(index)::value;
+                if(I < relocated) std::destroy_n(std::get<I>(tmp), size_);
+                if(I < allocated) std::allocator<Field<I>>().deallocate(std::get<I>(tmp), new_capacity);
+            });
+            throw;
+        }
+        ForEachColumn([&](auto index) {
+            constexpr std::size_t I = decltype(index)::value;
+            if constexpr(!std::is_trivially_copyable_v<Field<I>>) {
+                std::destroy_n(std::get<I>(columns_), size_);
+            }
+            if(std::get<I>(columns_)) std::allocator<Field<I>>().deallocate(std::get<I>(columns_), capacity_);
+        });
+        columns_ = tmp;
+        capacity_ = new_capacity;
+    }
+    Columns columns_{};
+    std::size_t size_{};
+    std::size_t capacity_{};
+};
+
+template<typename... Fields>
+std::ostream& operator<<(std::ostream& os, const SoAVector<Fields...>& vec) {
+    os << "[";
+    for(std::size_t i = 0; i < vec.Size(); i++) {
+        if(i) os << ", ";
+        os << "(";
+        std::apply([&os](const auto&... field) {
+            std::size_t n = 0;
+            ((os << (n++ ? ", " : "") << field), ...);
+        }, vec[i]);
+        os << ")";
+    }
+    os << "]";
+    return os;
+}
+}
+
+int main() {
+    // * 每筆紀錄有名稱、編號與分數；分數集中放在同一個column，掃描時不會把名稱一起載入cache。
+    STD::SoAVector<std::string, int, double> records;
+    records.PushBack({"alpha", 1, 2.5});
+    records.PushBack(std::make_tuple("beta", 2, 4.0));
+    records.EmplaceBack("gamma", 3, 1.5);
+    std::cout << records << std::endl;                 // [(alpha, 1, 2.5), (beta, 2, 4), (gamma, 3, 1.5)]
+
+    STD::Span<double> scores = records.Column<2>();
+    std::cout << std::accumulate(scores.begin(), scores.end(), 0.0) << std::endl; // 8
+    for(double& score: records.Column<2>()) {          // * 連續的double陣列，迴圈可以直接向量化。
+        score *= 2;
+    }
+    std::cout << *std::max_element(scores.begin(), scores.end()) << std::endl;   // 8
+
+    auto [name, id, score] = records[1];               // * 列代理：每個欄位的參考。
+    name = "BETA";
+    id += 10;
+    std::cout << records.Get<0>(1) << " " << records.Get<1>(1) << " " << score << std::endl; // BETA 12 8
+    records[0] = std::make_tuple("ALPHA", 0, 0.0);
+    records.PushBack(records[0]);                      // * 參考到自身元素的列，觸發重新配置也安全。
+    std::cout << records << std::endl;                 // [(ALPHA, 0, 0), (BETA, 12, 8), (gamma, 3, 3), (ALPHA, 0, 0)]
+
+    STD::SoAVector<std::string, int, double> copy = records;
+    copy.Resize(2);
+    records = std::move(copy);
+    std::cout << records.Size() << " " << copy.Size() << std::endl; // 2 0
+    records.Resize(3);
+    std::cout << records << std::endl;                 // [(ALPHA, 0, 0), (BETA, 12, 8), (, 0, 0)]
+    return 0;
+}
\ No newline at end of file
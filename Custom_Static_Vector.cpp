@@ -0,0 +1,383 @@
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+namespace STD{
+// * ContiguousIterator: 與Custom_Array.cpp相同的連續隨機存取迭代器，T為const時就是ConstIterator；
+//   讓std::sort、std::lower_bound等標準演算法可以直接作用在StaticVector上。
+template<typename T>
+class ContiguousIterator{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    ContiguousIterator() = default;
+    constexpr ContiguousIterator(T* ptr): ptr_(ptr) {}
+    // * Iterator可以隱式轉成ConstIterator，反之則不行。
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_const_v<U>>>
+    constexpr ContiguousIterator(const ContiguousIterator<U>& other): ptr_(other.Get()) {}
+    constexpr T* Get() const {
+        return ptr_;
+    }
+    constexpr T& operator*() const {
+        return *ptr_;
+    }
+    constexpr T* operator->() const {
+        return ptr_;
+    }
+    constexpr T& operator[](difference_type n) const {
+        return ptr_[n];
+    }
+    constexpr ContiguousIterator& operator++() {
+        ++ptr_;
+        return *this;
+    }
+    constexpr ContiguousIterator operator++(int) {
+        return ptr_++;
+    }
+    constexpr ContiguousIterator& operator--() {
+        --ptr_;
+        return *this;
+    }
+    constexpr ContiguousIterator operator--(int) {
+        return ptr_--;
+    }
+    constexpr ContiguousIterator& operator+=(difference_type n) {
+        ptr_ += n;
+        return *this;
+    }
+    constexpr ContiguousIterator& operator-=(difference_type n) {
+        ptr_ -= n;
+        return *this;
+    }
+    friend constexpr ContiguousIterator operator+(ContiguousIterator it, difference_type n) {
+        return it += n;
+    }
+    friend constexpr ContiguousIterator operator+(difference_type n, ContiguousIterator it) {
+        return it += n;
+    }
+    friend constexpr ContiguousIterator operator-(ContiguousIterator it, difference_type n) {
+        return it -= n;
+    }
+    friend constexpr difference_type operator-(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ - b.ptr_;
+    }
+    friend constexpr bool operator==(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ == b.ptr_;
+    }
+    friend constexpr bool operator!=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ != b.ptr_;
+    }
+    friend constexpr bool operator<(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ < b.ptr_;
+    }
+    friend constexpr bool operator>(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ > b.ptr_;
+    }
+    friend constexpr bool operator<=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ <= b.ptr_;
+    }
+    friend constexpr bool operator>=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ >= b.ptr_;
+    }
+  private:
+    T* ptr_{};
+};
+
+// * StaticVector: 容量固定為N、完全不向heap配置記憶體的Vector。與Array一樣元素放在物件內部，
+//   但那塊空間是未初始化的，只有實際放入的元素才會被建構，大小在執行時變動(0到N)。
+//   與SmallVector不同，超過N時不會搬到heap，而是拋出length_error(或以TryPushBack得到false)，
+//   因此整個物件可以放在stack上，已知上限的解析結果(例如封包的欄位)完全不需要配置記憶體。
+template<typename T, std::size_t N>
+class StaticVector{
+    template<typename U, std::size_t UN> friend std::ostream& operator<<(std::ostream& os, const StaticVector<U, UN>& vec);
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = ContiguousIterator<T>;
+    using const_iterator = ContiguousIterator<const T>;
+    StaticVector() = default;
+    explicit StaticVector(std::size_t size) {
+        Resize(size);
+    }
+    StaticVector(const std::initializer_list<T> lst) {
+        CheckCapacity(lst.size());
+        for(const T& val: lst) {
+            EmplaceBack(val);
+        }
+    }
+    StaticVector(const StaticVector& other) {
+        CopyFrom(other);
+    }
+    StaticVector& operator=(const StaticVector& other) {
+        if(&other == this) return *this;
+        Clear();
+        CopyFrom(other);
+        return *this;
+    }
+    StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        MoveFrom(other);
+    }
+    StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if(&other == this) return *this;
+        Clear();
+        MoveFrom(other);
+        return *this;
+    }
+    ~StaticVector() {
+        Clear();
+    }
+    T& operator[](std::size_t id) {
+        return Data()[id];
+    }
+    const T& operator[](std::size_t id) const {
+        return Data()[id];
+    }
+    T& At(std::size_t id) {
+        if(id >= size_) throw std::out_of_range("StaticVector Index Out of Bound");
+        return Data()[id];
+    }
+    const T& At(std::size_t id) const {
+        if(id >= size_) throw std::out_of_range("StaticVector Index Out of Bound");
+        return Data()[id];
+    }
+    T& Front() {
+        return Data()[0];
+    }
+    const T& Front() const {
+        return Data()[0];
+    }
+    T& Back() {
+        return Data()[size_-1];
+    }
+    const T& Back() const {
+        return Data()[size_-1];
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    static constexpr std::size_t Capacity() {
+        return N;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    bool Full() const {
+        return size_ == N;
+    }
+    void Resize(std::size_t new_size) {
+        CheckCapacity(new_size);
+        while(size_ < new_size) {
+            EmplaceBack();
+        }
+        while(size_ > new_size) {
+            PopBack();
+        }
+    }
+    void Clear() {
+        std::destroy(Data(), Data() + size_);
+        size_ = 0;
+    }
+    void PushBack(const T& val) {
+        EmplaceBack(val);
+    }
+    void PushBack(T&& val) {
+        EmplaceBack(std::move(val));
+    }
+    // * 元素永遠不會被搬移，因此args參考到自身元素也沒關係(不像Vector需要先建構暫存物件)。
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        CheckCapacity(size_ + 1);
+        T* slot = new (Data() + size_) T(std::forward<Args>(args)...);
+        size_++;
+        return *slot;
+    }
+    // * 不拋出例外的版本：已滿時回傳false，val不會被取走。
+    bool TryPushBack(const T& val) {
+        if(Full()) return false;
+        EmplaceBack(val);
+        return true;
+    }
+    bool TryPushBack(T&& val) {
+        if(Full()) return false;
+        EmplaceBack(std::move(val));
+        return true;
+    }
+    void PopBack() {
+        if(!Empty()) {
+            Data()[size_-1].~T();
+            size_--;
+        }
+    }
+    // * 移除第id個元素，後面的元素往前移，保持原本的順序。
+    void Erase(std::size_t id) {
+        Erase(id, id + 1);
+    }
+    // * 移除[first, last)範圍內的元素。
+    void Erase(std::size_t first, std::size_t last) {
+        if(first > last || last > size_) throw std::out_of_range("StaticVector Erase Out of Bound");
+        std::move(Data() + last, Data() + size_, Data() + first);
+        std::destroy(Data() + size_ - (last - first), Data() + size_);
+        size_ -= last - first;
+    }
+    void Fill(const T& val) {
+        std::fill(Data(), Data() + size_, val);
+    }
+    void Swap(StaticVector& other) {
+        StaticVector tmp = std::move(other);    // * 元素在物件內部，只能實際搬移，無法交換指標。
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+    using Iterator = ContiguousIterator<T>;
+    using ConstIterator = ContiguousIterator<const T>;
+    Iterator Begin() {
+        return {Data()};
+    }
+    ConstIterator Begin() const {
+        return {Data()};
+    }
+    Iterator End() {
+        return {Data() + size_};
+    }
+    ConstIterator End() const {
+        return {Data() + size_};
+    }
+    T* data() {
+        return Data();
+    }
+    const T* data() const {
+        return Data();
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    Iterator begin() {
+        return Begin();
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    Iterator end() {
+        return End();
+    }
+    ConstIterator end() const {
+        return End();
+    }
+  private:
+    T* Data() {
+        return std::launder(reinterpret_cast<T*>(storage_));
+    }
+    const T* Data() const {
+        return std::launder(reinterpret_cast<const T*>(storage_));
+    }
+    static void CheckCapacity(std::size_t size) {
+        if(size > N) throw std::length_error("StaticVector Capacity Exceeded");
+    }
+    // * trivially copyable的元素只複製實際使用的size_個，一次memcpy完成。
+    void CopyFrom(const StaticVector& other) {
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            std::memcpy(static_cast<void*>(storage_), static_cast<const void*>(other.storage_), sizeof(T) * other.size_);
+            size_ = other.size_;
+        } else {
+            for(std::size_t i = 0; i < other.size_; i++) {
+                EmplaceBack(other[i]);
+            }
+        }
+    }
+    void MoveFrom(StaticVector& other) {
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            CopyFrom(other);
+        } else {
+            for(std::size_t i = 0; i < other.size_; i++) {
+                EmplaceBack(std::move(other[i]));
+            }
+        }
+        other.Clear();
+    }
+    alignas(T) unsigned char storage_[sizeof(T) * N];
+    std::size_t size_{};
+};
+
+template<typename T, std::size_t N>
+typename StaticVector<T, N>::ConstIterator Begin(const StaticVector<T, N>& vec) {
+    return vec.Begin();
+}
+template<typename T, std::size_t N>
+typename StaticVector<T, N>::ConstIterator End(const StaticVector<T, N>& vec) {
+    return vec.End();
+}
+
+template<typename T, std::size_t N>
+std::ostream& operator<<(std::ostream& os, const StaticVector<T, N>& vec) {
+    os << "[";
+    for(typename StaticVector<T, N>::ConstIterator it = Begin(vec); it != End(vec); it++) {
+        if(it != Begin(vec)) os << ", ";
+        os << *it;
+    }
+    os << "]";
+    return os;
+}
+}
+
+// * 把"key=value&key=value"形式的查詢字串切成欄位，最多kMaxFields個；結果全部在stack上。
+constexpr std::size_t kMaxFields = 4;
+STD::StaticVector<std::string_view, kMaxFields> ParseQuery(std::string_view query) {
+    STD::StaticVector<std::string_view, kMaxFields> fields;
+    while(!query.empty()) {
+        std::size_t amp = query.find('&');
+        if(!fields.TryPushBack(query.substr(0, amp))) break;  // * 超過上限的欄位直接忽略。
+        query = amp == std::string_view::npos ? std::string_view() : query.substr(amp + 1);
+    }
+    return fields;
+}
+
+int main() {
+    STD::StaticVector<int, 8> v {5, 3, 9};
+    v.PushBack(1);
+    v.EmplaceBack(7);
+    std::cout << v << " " << v.Size() << "/" << v.Capacity() << std::endl; // [5, 3, 9, 1, 7] 5/8
+    std::sort(v.begin(), v.end());                                      // * 隨機存取迭代器，可以直接使用標準演算法。
+    v.Erase(1);
+    v.Erase(2, 4);
+    std::cout << v << std::endl;                                        // [1, 5]
+    v.Resize(4);
+    std::cout << v << " " << sizeof(v) << std::endl;                    // [1, 5, 0, 0] 40 (元素就在物件內部)
+
+    auto fields = ParseQuery("id=42&name=ray&lang=zh&page=2&sort=asc");
+    std::cout << fields << " " << fields.Full() << std::endl;           // [id=42, name=ray, lang=zh, page=2] 1
+
+    STD::StaticVector<std::string, 3> words;
+    words.EmplaceBack(3, 'z');
+    words.PushBack("static");
+    words.PushBack(words[0]);                                           // * 元素永遠不會被搬移，參考到自身元素也安全。
+    STD::StaticVector<std::string, 3> moved = std::move(words);
+    std::cout << moved << " " << words.Size() << std::endl;             // [zzz, static, zzz] 0
+    words = moved;
+    words.Erase(0);
+    words.Swap(moved);
+    std::cout << words << " " << moved << std::endl;                    // [zzz, static, zzz] [static, zzz]
+    try {
+        words.PushBack("overflow");
+    } catch(const std::length_error& e) {
+        std::cout << e.what() << std::endl;                             // StaticVector Capacity Exceeded
+    }
+    return 0;
+}
\ No newline at end of file
@@ -1,189 +1,2445 @@
 #include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory_resource>
+#include <vector>
+#include <deque>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <utility>
+#include <cstdint>
+#include <stdexcept>
+#include <limits>
+#include <sstream>
+#include <numeric>
+#include <cmath>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 namespace STD{
+// * 可以「逐位元組搬移」(bitwise relocation)的型別：把物件的位元組memcpy到新位址後，舊位址視同已解構，
+//   不需要再呼叫移動建構子與解構子。所有trivially copyable的型別都符合；內部沒有指向自己的指標的使用者型別
+//   (例如只持有heap指標的容器)也可以自行特化此trait為true來啟用快速路徑。
 template<typename T>
+struct IsTriviallyRelocatable: std::is_trivially_copyable<T> {};
+template<typename T>
+struct IsTriviallyRelocatable<std::allocator<T>>: std::true_type {};
+// * 配置器是否自訂了construct或destroy。沒有自訂時(例如std::allocator)allocator_traits::construct就是placement new，
+//   容器可以改用memcpy、std::uninitialized_*等批次操作；有自訂時(例如polymorphic_allocator會把自己傳給
+//   uses-allocator的元素，元素內部的配置也因此來自同一個arena)每個元素都必須經過它。
+template<typename A, typename T, typename = void>
+struct HasCustomConstruct: std::false_type {};
+template<typename A, typename T>
+struct HasCustomConstruct<A, T, std::void_t<decltype(std::declval<A&>().construct(std::declval<T*>(), std::declval<const T&>()))>>: std::true_type {};
+template<typename A, typename T, typename = void>
+struct HasCustomDestroy: std::false_type {};
+template<typename A, typename T>
+struct HasCustomDestroy<A, T, std::void_t<decltype(std::declval<A&>().destroy(std::declval<T*>()))>>: std::true_type {};
+template<typename A, typename T>
+struct UsesPlainConstruct: std::disjunction<std::is_same<A, std::allocator<T>>,
+                                            std::negation<std::disjunction<HasCustomConstruct<A, T>, HasCustomDestroy<A, T>>>> {};
+
+// * SIMD kernels: Fill/Find/Count/Min/Max/Sum/Dot對連續記憶體的實作。
+//   Packed<T, Bytes>以GCC/Clang的vector extension撰寫一次與寬度無關的迴圈，再由Sse2/Avx2/Avx512這三個
+//   標上target屬性的包裝層分別以16/32/64 bytes的暫存器寬度實體化；執行時透過CPUID(__builtin_cpu_supports)
+//   選出機器支援的最寬版本。非算術型別或非x86平台一律退回Scalar。
+//   注意：浮點數的Sum/Dot以多個lane分別累加，結果可能與逐一相加的順序有些微捨入誤差。
+namespace simd{
+template<typename T>
+inline constexpr bool kVectorizable = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                                      !std::is_same_v<T, long double>;
+
+template<typename T>
+struct Scalar{
+    static void Fill(T* p, std::size_t n, const T& val) {
+        for(std::size_t i = 0; i < n; i++) {
+            p[i] = val;
+        }
+    }
+    static std::size_t Find(const T* p, std::size_t n, const T& val) {
+        for(std::size_t i = 0; i < n; i++) {
+            if(p[i] == val) return i;
+        }
+        return n;
+    }
+    static std::size_t Count(const T* p, std::size_t n, const T& val) {
+        std::size_t cnt = 0;
+        for(std::size_t i = 0; i < n; i++) {
+            if(p[i] == val) cnt++;
+        }
+        return cnt;
+    }
+    static T Min(const T* p, std::size_t n) {
+        T res = p[0];
+        for(std::size_t i = 1; i < n; i++) {
+            if(p[i] < res) res = p[i];
+        }
+        return res;
+    }
+    static T Max(const T* p, std::size_t n) {
+        T res = p[0];
+        for(std::size_t i = 1; i < n; i++) {
+            if(res < p[i]) res = p[i];
+        }
+        return res;
+    }
+    static T Sum(const T* p, std::size_t n) {
+        T res{};
+        for(std::size_t i = 0; i < n; i++) {
+            res += p[i];
+        }
+        return res;
+    }
+    static T Dot(const T* a, const T* b, std::size_t n) {
+        T res{};
+        for(std::size_t i = 0; i < n; i++) {
+            res += a[i] * b[i];
+        }
+        return res;
+    }
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+template<typename T, int Bytes>
+struct Packed{
+    typedef T V __attribute__((vector_size(Bytes)));
+    typedef T Unaligned __attribute__((vector_size(Bytes), aligned(alignof(T)), __may_alias__));
+    using Mask = decltype(V{} == V{});          // * 比較結果：每個lane為0或-1的同寬整數向量。
+    static constexpr std::size_t kLanes = Bytes / sizeof(T);
+
+    // * 以不要求對齊的向量型別讀寫任意位址(同_mm256_loadu_ps)，以指標傳遞以免向量在函式邊界上傳值。
+    __attribute__((always_inline)) static const Unaligned* At(const T* p) {
+        return reinterpret_cast<const Unaligned*>(p);
+    }
+    __attribute__((always_inline)) static bool Any(const Mask& m) {
+        const Mask zero{};
+        return std::memcmp(&m, &zero, sizeof(Mask)) != 0;
+    }
+    __attribute__((always_inline)) static void Fill(T* p, std::size_t n, T val) {
+        const V v = V{} + val;
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            *reinterpret_cast<Unaligned*>(p + i) = v;
+        }
+        Scalar<T>::Fill(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static std::size_t Find(const T* p, std::size_t n, T val) {
+        const V v = V{} + val;
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            Mask m = *At(p + i) == v;
+            if(Any(m)) {
+                for(std::size_t j = 0; j < kLanes; j++) {
+                    if(m[j]) return i + j;
+                }
+            }
+        }
+        return i + Scalar<T>::Find(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static std::size_t Count(const T* p, std::size_t n, T val) {
+        // * 每個lane以-1累減計數；lane只有sizeof(T)寬，因此每隔kFlush個區塊就把計數倒回size_t以免溢位。
+        constexpr std::size_t kFlush = sizeof(T) == 1 ? 127 : sizeof(T) == 2 ? 32767 : (1u << 30);
+        const V v = V{} + val;
+        Mask acc{};
+        std::size_t cnt = 0, blocks = 0, i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc -= (*At(p + i) == v);
+            if(++blocks == kFlush) {
+                for(std::size_t j = 0; j < kLanes; j++) cnt += acc[j];
+                acc = Mask{};
+                blocks = 0;
+            }
+        }
+        for(std::size_t j = 0; j < kLanes; j++) cnt += acc[j];
+        return cnt + Scalar<T>::Count(p + i, n - i, val);
+    }
+    __attribute__((always_inline)) static T Min(const T* p, std::size_t n) {
+        if(n < kLanes) return Scalar<T>::Min(p, n);
+        V acc = *At(p);
+        std::size_t i = kLanes;
+        for(; i + kLanes <= n; i += kLanes) {
+            V x = *At(p + i);
+            acc = x < acc ? x : acc;
+        }
+        T res = acc[0];
+        for(std::size_t j = 1; j < kLanes; j++) {
+            if(acc[j] < res) res = acc[j];
+        }
+        for(; i < n; i++) {
+            if(p[i] < res) res = p[i];
+        }
+        return res;
+    }
+    __attribute__((always_inline)) static T Max(const T* p, std::size_t n) {
+        if(n < kLanes) return Scalar<T>::Max(p, n);
+        V acc = *At(p);
+        std::size_t i = kLanes;
+        for(; i + kLanes <= n; i += kLanes) {
+            V x = *At(p + i);
+            acc = acc < x ? x : acc;
+        }
+        T res = acc[0];
+        for(std::size_t j = 1; j < kLanes; j++) {
+            if(res < acc[j]) res = acc[j];
+        }
+        for(; i < n; i++) {
+            if(res < p[i]) res = p[i];
+        }
+        return res;
+    }
+    __attribute__((always_inline)) static T Sum(const T* p, std::size_t n) {
+        V acc{};
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc += *At(p + i);
+        }
+        T res = Scalar<T>::Sum(p + i, n - i);
+        for(std::size_t j = 0; j < kLanes; j++) res += acc[j];
+        return res;
+    }
+    __attribute__((always_inline)) static T Dot(const T* a, const T* b, std::size_t n) {
+        V acc{};
+        std::size_t i = 0;
+        for(; i + kLanes <= n; i += kLanes) {
+            acc += *At(a + i) * *At(b + i);
+        }
+        T res = Scalar<T>::Dot(a + i, b + i, n - i);
+        for(std::size_t j = 0; j < kLanes; j++) res += acc[j];
+        return res;
+    }
+};
+
+template<typename T>
+struct Sse2{
+    using P = Packed<T, 16>;
+    __attribute__((target("sse2"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("sse2"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("sse2"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("sse2"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("sse2"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("sse2"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("sse2"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+template<typename T>
+struct Avx2{
+    using P = Packed<T, 32>;
+    __attribute__((target("avx2"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("avx2"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("avx2"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("avx2"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("avx2"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("avx2"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("avx2"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+template<typename T>
+struct Avx512{
+    using P = Packed<T, 64>;
+    __attribute__((target("avx512f,avx512bw"))) static void Fill(T* p, std::size_t n, T val) { P::Fill(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static std::size_t Find(const T* p, std::size_t n, T val) { return P::Find(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static std::size_t Count(const T* p, std::size_t n, T val) { return P::Count(p, n, val); }
+    __attribute__((target("avx512f,avx512bw"))) static T Min(const T* p, std::size_t n) { return P::Min(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Max(const T* p, std::size_t n) { return P::Max(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Sum(const T* p, std::size_t n) { return P::Sum(p, n); }
+    __attribute__((target("avx512f,avx512bw"))) static T Dot(const T* a, const T* b, std::size_t n) { return P::Dot(a, b, n); }
+};
+
+enum class Isa{ kScalar, kSse2, kAvx2, kAvx512 };
+inline Isa DetectIsa() {
+    static const Isa isa = [] {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::kAvx512;
+        if(__builtin_cpu_supports("avx2")) return Isa::kAvx2;
+        if(__builtin_cpu_supports("sse2")) return Isa::kSse2;
+        return Isa::kScalar;
+    }();
+    return isa;
+}
+#endif
+
+// * 以kernel(Scalar<T>、Sse2<T>、...其中之一)的型別呼叫f，讓每個操作只需寫一次分派。
+template<typename T, typename F>
+decltype(auto) Dispatch(F&& f) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if constexpr(kVectorizable<T>) {
+        switch(DetectIsa()) {
+            case Isa::kAvx512: return f(Avx512<T>{});
+            case Isa::kAvx2:   return f(Avx2<T>{});
+            case Isa::kSse2:   return f(Sse2<T>{});
+            case Isa::kScalar: break;
+        }
+    }
+#endif
+    return f(Scalar<T>{});
+}
+template<typename T>
+void Fill(T* p, std::size_t n, const T& val) {
+    Dispatch<T>([&](auto kernel) { decltype(kernel)::Fill(p, n, val); });
+}
+template<typename T>
+std::size_t Find(const T* p, std::size_t n, const T& val) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Find(p, n, val); });
+}
+template<typename T>
+std::size_t Count(const T* p, std::size_t n, const T& val) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Count(p, n, val); });
+}
+template<typename T>
+T Min(const T* p, std::size_t n) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Min(p, n); });
+}
+template<typename T>
+T Max(const T* p, std::size_t n) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Max(p, n); });
+}
+template<typename T>
+T Sum(const T* p, std::size_t n) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Sum(p, n); });
+}
+template<typename T>
+T Dot(const T* a, const T* b, std::size_t n) {
+    return Dispatch<T>([&](auto kernel) { return decltype(kernel)::Dot(a, b, n); });
+}
+}
+
+// * ContiguousIterator: 元素連續存放的容器共用的隨機存取迭代器，T為const時就是ConstIterator。
+//   提供完整的iterator_traits(C++20起另標示為contiguous_iterator)，std::sort、std::lower_bound以及
+//   std::reduce(std::execution::par, ...)等標準演算法都能直接在容器上執行，不必先複製到std::vector。
+template<typename T>
+class ContiguousIterator{
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+    using iterator_concept = std::contiguous_iterator_tag;
+#endif
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    ContiguousIterator() = default;
+    ContiguousIterator(T* ptr): ptr_(ptr) {}
+    // * Iterator可以隱式轉成ConstIterator，反之則不行。
+    template<typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_const_v<U>>>
+    ContiguousIterator(const ContiguousIterator<U>& other): ptr_(other.Get()) {}
+    T* Get() const {
+        return ptr_;
+    }
+    T& operator*() const {
+        return *ptr_;
+    }
+    T* operator->() const {
+        return ptr_;
+    }
+    T& operator[](difference_type n) const {
+        return ptr_[n];
+    }
+    ContiguousIterator& operator++() {
+        ++ptr_;
+        return *this;
+    }
+    ContiguousIterator operator++(int) {
+        return ptr_++;
+    }
+    ContiguousIterator& operator--() {
+        --ptr_;
+        return *this;
+    }
+    ContiguousIterator operator--(int) {
+        return ptr_--;
+    }
+    ContiguousIterator& operator+=(difference_type n) {
+        ptr_ += n;
+        return *this;
+    }
+    ContiguousIterator& operator-=(difference_type n) {
+        ptr_ -= n;
+        return *this;
+    }
+    friend ContiguousIterator operator+(ContiguousIterator it, difference_type n) {
+        return it += n;
+    }
+    friend ContiguousIterator operator+(difference_type n, ContiguousIterator it) {
+        return it += n;
+    }
+    friend ContiguousIterator operator-(ContiguousIterator it, difference_type n) {
+        return it -= n;
+    }
+    friend difference_type operator-(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ - b.ptr_;
+    }
+    friend bool operator==(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ == b.ptr_;
+    }
+    friend bool operator!=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ != b.ptr_;
+    }
+    friend bool operator<(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ < b.ptr_;
+    }
+    friend bool operator>(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ > b.ptr_;
+    }
+    friend bool operator<=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ <= b.ptr_;
+    }
+    friend bool operator>=(const ContiguousIterator& a, const ContiguousIterator& b) {
+        return a.ptr_ >= b.ptr_;
+    }
+  private:
+    T* ptr_{};
+};
+
+// * 成長策略(growth policy)：Next(capacity, required, elem_size)回傳容量不足時的新容量(元素個數)，至少要是required。
+//   kTrackStats為true時，Vector會記錄重新配置的次數、搬移的位元組數以及容量的最大值(見Vector::Stats)，
+//   預設關閉，不需要時完全沒有額外成本。
+namespace growth{
+// * 每次加倍：重新配置的次數最少，但最多會浪費一半的容量。
+struct Doubling{
+    static constexpr bool kTrackStats = false;
+    static std::size_t Next(std::size_t capacity, std::size_t required, std::size_t) {
+        return std::max(required, 2 * capacity);
+    }
+};
+// * 每次成長1.5倍：浪費的容量較少，而且釋放掉的舊緩衝區加總起來最終能被之後的配置重複利用。
+struct OneAndHalf{
+    static constexpr bool kTrackStats = false;
+    static std::size_t Next(std::size_t capacity, std::size_t required, std::size_t) {
+        return std::max(required, capacity + capacity / 2);
+    }
+};
+// * 每次固定增加Step個元素：記憶體最省，但重新配置的次數與元素個數成正比，只適合上限大致已知的情況。
+template<std::size_t Step>
+struct FixedStep{
+    static_assert(Step > 0, "FixedStep must grow by at least one element");
+    static constexpr bool kTrackStats = false;
+    static std::size_t Next(std::size_t capacity, std::size_t required, std::size_t) {
+        return std::max(required, capacity + Step);
+    }
+};
+// * 把Base算出的緩衝區大小向上取整到整數個分頁：大型配置本來就以分頁為單位取得，剩下的零頭不如拿來放元素。
+template<typename Base = Doubling, std::size_t PageSize = 4096>
+struct PageRounded{
+    static constexpr bool kTrackStats = Base::kTrackStats;
+    static std::size_t Next(std::size_t capacity, std::size_t required, std::size_t elem_size) {
+        std::size_t bytes = Base::Next(capacity, required, elem_size) * elem_size;
+        bytes = (bytes + PageSize - 1) / PageSize * PageSize;
+        return bytes / elem_size;
+    }
+};
+// * 把Base算出的緩衝區大小向上取整到jemalloc的size class：128 bytes以下以16 bytes為間隔，之後每個二倍區間
+//   (2^k, 2^(k+1)]再等分成4個class(160、192、224、256、320...)。配置器反正會交出整個class，多出來的部分直接當作容量。
+template<typename Base = Doubling>
+struct SizeClass{
+    static constexpr bool kTrackStats = Base::kTrackStats;
+    static std::size_t RoundUp(std::size_t bytes) {
+        if(bytes <= 8) return 8;
+        if(bytes <= 128) return (bytes + 15) / 16 * 16;
+        int lg = 63 - __builtin_clzll(bytes - 1);   // * bytes落在(2^lg, 2^(lg+1)]之間。
+        std::size_t spacing = std::size_t{1} << (lg - 2);
+        return (bytes + spacing - 1) / spacing * spacing;
+    }
+    static std::size_t Next(std::size_t capacity, std::size_t required, std::size_t elem_size) {
+        return RoundUp(Base::Next(capacity, required, elem_size) * elem_size) / elem_size;
+    }
+};
+// * 在Policy之上開啟統計，例如Vector<int, std::allocator<int>, growth::Tracked<growth::OneAndHalf>>。
+template<typename Policy>
+struct Tracked: Policy{
+    static constexpr bool kTrackStats = true;
+};
+}
+
+// * 開啟統計的成長策略所記錄的數值：reallocations為換過幾次緩衝區，bytes_moved為因此搬移的元素位元組數
+//   (realloc可能原地擴張而實際上不必搬移，仍以上限計)，peak_capacity為容量曾經到達的最大值。
+struct VectorStats{
+    std::size_t reallocations{};
+    std::size_t bytes_moved{};
+    std::size_t peak_capacity{};
+};
+
+// * 運算式樣板(expression templates)：a * 2 + b這類逐元素運算不會立刻計算，也不會為中間結果配置暫存的Vector，
+//   而是建出一棵描述運算的樹(Binary/Unary節點，葉子是容器的參考或純量)；直到賦值給Vector時，
+//   才以單一迴圈out[i] = 樹[i]一次算完。整棵樹在編譯期就已確定並完全inline，迴圈可以直接被編譯器向量化。
+//   容器以參考保存，因此運算式必須在同一個完整運算式中使用(例如auto e = a + b之後a被解構，e就失效了)。
+namespace expr{
+inline constexpr std::size_t kAnySize = static_cast<std::size_t>(-1);
+template<typename E>
+struct Expr{
+    const E& Self() const {
+        return static_cast<const E&>(*this);
+    }
+};
+// * 可以作為運算式葉子的容器(各容器在定義之後特化)。
+template<typename T>
+struct IsTerminal: std::false_type {};
+template<typename T>
+inline constexpr bool kIsOperand = IsTerminal<T>::value || std::is_base_of_v<Expr<T>, T>;
+// * 純量：每個位置都是同一個值，大小配合另一邊。
+template<typename T>
+class Scalar: public Expr<Scalar<T>>{
+  public:
+    explicit Scalar(T val): val_(val) {}
+    T operator[](std::size_t) const {
+        return val_;
+    }
+    std::size_t Size() const {
+        return kAnySize;
+    }
+  private:
+    T val_;
+};
+template<typename T>
+using Wrapped = std::conditional_t<std::is_arithmetic_v<T>, Scalar<T>, T>;
+template<typename T>
+std::conditional_t<std::is_arithmetic_v<T>, Scalar<T>, const T&> Wrap(const T& val) {
+    if constexpr(std::is_arithmetic_v<T>) {
+        return Scalar<T>(val);
+    } else {
+        return val;
+    }
+}
+// * 容器以參考保存，節點(暫存物件)以值保存。
+template<typename T>
+using Stored = std::conditional_t<IsTerminal<T>::value, const T&, T>;
+template<typename T>
+std::size_t SizeOf(const T& e) {
+    return static_cast<std::size_t>(e.Size());
+}
+template<typename Op, typename L, typename R>
+class Binary: public Expr<Binary<Op, L, R>>{
+  public:
+    Binary(const L& l, const R& r): l_(l), r_(r) {
+        if(SizeOf(l_) != kAnySize && SizeOf(r_) != kAnySize && SizeOf(l_) != SizeOf(r_)) {
+            throw std::invalid_argument("Expression Size Mismatch");
+        }
+    }
+    auto operator[](std::size_t id) const {
+        return Op()(l_[id], r_[id]);
+    }
+    std::size_t Size() const {
+        return SizeOf(l_) != kAnySize ? SizeOf(l_) : SizeOf(r_);
+    }
+  private:
+    Stored<L> l_;
+    Stored<R> r_;
+};
+template<typename Op, typename E>
+class Unary: public Expr<Unary<Op, E>>{
+  public:
+    explicit Unary(const E& e): e_(e) {}
+    auto operator[](std::size_t id) const {
+        return Op()(e_[id]);
+    }
+    std::size_t Size() const {
+        return SizeOf(e_);
+    }
+  private:
+    Stored<E> e_;
+};
+struct AbsOp{
+    template<typename T>
+    auto operator()(T val) const {
+        using std::abs;
+        return abs(val);
+    }
+};
+// * std::sqrt必須設定errno，迴圈要向量化需以-fno-math-errno編譯(-ffast-math也包含此選項)。
+struct SqrtOp{
+    template<typename T>
+    auto operator()(T val) const {
+        using std::sqrt;
+        return sqrt(val);
+    }
+};
+// * 至少一邊是容器或運算式，另一邊是容器、運算式或純量時，運算子才會參與多載決議。
+template<typename L, typename R>
+inline constexpr bool kBinaryOperands = (kIsOperand<L> && (kIsOperand<R> || std::is_arithmetic_v<R>)) ||
+                                        (std::is_arithmetic_v<L> && kIsOperand<R>);
+template<typename Op, typename L, typename R>
+Binary<Op, Wrapped<L>, Wrapped<R>> MakeBinary(const L& l, const R& r) {
+    return {Wrap(l), Wrap(r)};
+}
+}
+
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator+(const L& l, const R& r) {
+    return expr::MakeBinary<std::plus<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator-(const L& l, const R& r) {
+    return expr::MakeBinary<std::minus<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator*(const L& l, const R& r) {
+    return expr::MakeBinary<std::multiplies<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto operator/(const L& l, const R& r) {
+    return expr::MakeBinary<std::divides<>>(l, r);
+}
+// * 逐元素比較是具名函式而不是運算子，結果是bool的運算式，可以賦值給Vector<bool>當作遮罩。
+//   ==、<等運算子保留給容器本身的比較(整個容器相等、字典序)，std::less、FlatSet<Vector<int>>等才能照常使用。
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Less(const L& l, const R& r) {
+    return expr::MakeBinary<std::less<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Greater(const L& l, const R& r) {
+    return expr::MakeBinary<std::greater<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto LessEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::less_equal<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto GreaterEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::greater_equal<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto Equal(const L& l, const R& r) {
+    return expr::MakeBinary<std::equal_to<>>(l, r);
+}
+template<typename L, typename R, typename = std::enable_if_t<expr::kBinaryOperands<L, R>>>
+auto NotEqual(const L& l, const R& r) {
+    return expr::MakeBinary<std::not_equal_to<>>(l, r);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto operator-(const E& e) {
+    return expr::Unary<std::negate<>, E>(e);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto Abs(const E& e) {
+    return expr::Unary<expr::AbsOp, E>(e);
+}
+template<typename E, typename = std::enable_if_t<expr::kIsOperand<E>>>
+auto Sqrt(const E& e) {
+    return expr::Unary<expr::SqrtOp, E>(e);
+}
+
+// * Allocator: 負責配置/釋放緩衝區的配置器，介面與標準容器相同(透過std::allocator_traits呼叫)。
+//   例如傳入std::pmr::polymorphic_allocator<T>並指向一個std::pmr::monotonic_buffer_resource，就能讓
+//   一整批容器共用同一塊arena，最後隨著arena一次釋放。
+//   Growth: 容量不足時的成長策略，見namespace growth。
+template<typename T, typename Allocator = std::allocator<T>, typename Growth = growth::Doubling>
 class Vector{
-    template<typename U> friend std::ostream& operator<<(std::ostream& os, const Vector<U>& vec);
+    template<typename U, typename A, typename G> friend std::ostream& operator<<(std::ostream& os, const Vector<U, A, G>& vec);
+    using AllocTraits = std::allocator_traits<Allocator>;
   public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    // * Find找不到時的回傳值。
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = ContiguousIterator<T>;
+    using const_iterator = ContiguousIterator<const T>;
     Vector() = default;
-    Vector(int size): size_(size) {
+    explicit Vector(const Allocator& alloc): alloc_(alloc) {}
+    Vector(std::size_t size, const Allocator& alloc = Allocator()): alloc_(alloc) {
         Resize(size);
     }
-    Vector(const std::initializer_list<T> lst) {
-        size_ = lst.size();
-        capacity_ = size_;
-        data_ = new T[capacity_] {};
-        int i = 0;
-        for(const T& val: lst) {
-            data_[i] = val;
-            i++;
+    Vector(const std::initializer_list<T> lst, const Allocator& alloc = Allocator()): alloc_(alloc) {
+        buffer_ = data_ = Allocate(lst.size());
+        capacity_ = lst.size();
+        CopyConstruct(lst.begin(), lst.size(), data_);
+        size_ = lst.size();
+        TrackCapacity();
+    }
+    // * 由運算式樣板建構/賦值：以單一迴圈計算整棵運算樹，不配置任何暫存的Vector。
+    template<typename E>
+    Vector(const expr::Expr<E>& e, const Allocator& alloc = Allocator()): alloc_(alloc) {
+        Assign(e.Self());
+    }
+    template<typename E>
+    Vector& operator=(const expr::Expr<E>& e) {
+        Assign(e.Self());
+        return *this;
+    }
+    Vector(const Vector& other): Vector(other, AllocTraits::select_on_container_copy_construction(other.alloc_)) {}
+    Vector(const Vector& other, const Allocator& alloc): alloc_(alloc) {
+        buffer_ = data_ = Allocate(other.size_);
+        capacity_ = other.size_;
+        CopyConstruct(other.data_, other.size_, data_);
+        size_ = other.size_;
+        TrackCapacity();
+    }
+    Vector& operator=(const Vector& other) {
+        if(&other == this) return *this;
+        if constexpr(std::is_trivially_copyable_v<T>) {
+            if(other.size_ <= capacity_ && alloc_ == other.alloc_) { // * 容量足夠時直接覆寫現有緩衝區，不必重新配置。
+                data_ = buffer_;
+                CopyConstruct(other.data_, other.size_, data_);
+                size_ = other.size_;
+                return *this;
+            }
+        }
+        // * 先完整複製一份再交換，複製途中若拋出例外，*this仍維持原狀。暫存物件使用交換後*this應持有的配置器，
+        //   這樣交換緩衝區之後每塊記憶體仍然由配置它的配置器釋放。
+        Vector tmp(other, AllocTraits::propagate_on_container_copy_assignment::value ? other.alloc_ : alloc_);
+        SwapStorage(tmp);
+        if constexpr(AllocTraits::propagate_on_container_copy_assignment::value) {
+            std::swap(alloc_, tmp.alloc_);
+        }
+        return *this;
+    }
+    Vector(Vector&& other) noexcept: alloc_(std::move(other.alloc_)) {
+        SwapStorage(other);
+    }
+    Vector& operator=(Vector&& other) noexcept(AllocTraits::propagate_on_container_move_assignment::value ||
+                                               AllocTraits::is_always_equal::value) {
+        if(&other == this) return *this;
+        Clear();
+        Deallocate(buffer_, capacity_);
+        buffer_ = data_ = nullptr;
+        capacity_ = 0;
+        if constexpr(AllocTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+        }
+        if(alloc_ == other.alloc_) {
+            SwapStorage(other);
+        } else {                                // * 兩邊的配置器不相等時不能接手對方的緩衝區，只能逐一移動元素。
+            Reallocate(other.size_);
+            CopyConstruct(std::make_move_iterator(other.data_), other.size_, data_);
+            size_ = other.size_;
+            other.Clear();
+        }
+        return *this;
+    }
+    ~Vector() {
+        Clear();
+        Deallocate(buffer_, capacity_);
+    }
+    Allocator GetAllocator() const {
+        return alloc_;
+    }
+    T& operator[](std::size_t id) {
+        return data_[id];
+    }
+    const T& operator[](std::size_t id) const {
+        return data_[id];
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    std::size_t Capacity() const {
+        return capacity_;
+    }
+    // * 配置器能配置的最大元素個數；超過時Reserve/Resize/PushBack等會拋出std::length_error，而不是讓容量計算溢位。
+    std::size_t MaxSize() const {
+        return AllocTraits::max_size(alloc_);
+    }
+    const VectorStats& Stats() const {
+        static_assert(Growth::kTrackStats, "use growth::Tracked<Policy> to enable reallocation statistics");
+        return stats_;
+    }
+    void Resize(std::size_t new_size) {
+        if(new_size > BackCapacity()) {
+            std::size_t new_capacity = Grow(new_size);
+            Reallocate(new_capacity, FrontGap() == 0 ? 0 : (new_capacity - new_size) / 2);
+        }
+        if(new_size > size_) {                  // * 只有[size_, new_size)這段才需要值初始化，其餘的容量維持未初始化狀態。
+            ValueConstruct(data_ + size_, new_size - size_);
+        }
+        Destroy(data_ + std::min(new_size, size_), data_ + size_);
+        size_ = new_size;
+    }
+    void Clear() {
+        Destroy(data_, data_ + size_);
+        data_ = buffer_;
+        size_ = 0;
+    }
+    // * 預先保留容量：之後Size()成長到new_capacity之前都不會重新配置，但不會改變size_。
+    void Reserve(std::size_t new_capacity) {
+        if(new_capacity > MaxSize()) throw std::length_error("Vector Too Large");
+        if(new_capacity > BackCapacity()) {
+            Reallocate(new_capacity);
+        }
+    }
+    // * 釋放多餘的容量(包含前端保留的空間)，讓capacity_剛好等於size_。
+    void ShrinkToFit() {
+        if(size_ == capacity_) return;
+        if(size_ == 0) {
+            Deallocate(buffer_, capacity_);
+            buffer_ = data_ = nullptr;
+            capacity_ = 0;
+            return;
+        }
+        Reallocate(size_);
+    }
+    void PushBack(const T& val) {
+        EmplaceBack(val);
+    }
+    void PushBack(T&& val) {
+        EmplaceBack(std::move(val));
+    }
+    template<typename... Args>
+    T& EmplaceBack(Args&&... args) {
+        if(size_ == BackCapacity()) {
+            if(CanRecenter()) {                 // * 空間都在前端(例如當作佇列使用)：原地移回中央，不重新配置。
+                T val(std::forward<Args>(args)...); // * args可能參考到即將被移動的元素。
+                Recenter();
+                Construct(data_ + size_, std::move(val));
+                return data_[size_++];
+            }
+            if constexpr(kBitwiseRelocatable && kUseMalloc) {
+                if(FrontGap() == 0) {
+                    T val(std::forward<Args>(args)...); // * 先建構出新元素，realloc之後args可能參考到已失效的舊位址。
+                    Reallocate(Grow(size_ + 1));
+                    Construct(data_ + size_, std::move(val));
+                    return data_[size_++];
+                }
+            }
+            // * 先在新的記憶體上建構新元素，再搬移舊元素，避免args參考到舊緩衝區中的元素(例如v.PushBack(v[0]))時，
+            //   舊元素已被搬走。前端原本有保留空間(曾經PushFront過)時，新緩衝區的剩餘空間平均分給兩端。
+            std::size_t new_capacity = Grow(size_ + 1);
+            std::size_t new_front = FrontGap() == 0 ? 0 : (new_capacity - size_ - 1) / 2;
+            ReallocateWith(new_capacity, new_front, new_front + size_, std::forward<Args>(args)...);
+        } else {
+            Construct(data_ + size_, std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+    void PushFront(const T& val) {
+        EmplaceFront(val);
+    }
+    void PushFront(T&& val) {
+        EmplaceFront(std::move(val));
+    }
+    // * 雙端緩衝(devector)：data_之前保留一段未初始化的空間，PushFront只要前端還有空間就直接在data_[-1]建構，
+    //   用完時才重新配置並把剩餘空間平均分給兩端，因此前後插入都是攤銷O(1)，資料也一直保持連續。
+    template<typename... Args>
+    T& EmplaceFront(Args&&... args) {
+        if(FrontGap() == 0 && CanRecenter()) {
+            T val(std::forward<Args>(args)...);
+            Recenter();
+            Construct(data_ - 1, std::move(val));
+            data_--;
+        } else if(FrontGap() == 0) {
+            std::size_t new_capacity = Grow(size_ + 1);
+            std::size_t new_front = (new_capacity - size_) / 2;
+            ReallocateWith(new_capacity, new_front + 1, new_front, std::forward<Args>(args)...);
+        } else {
+            Construct(data_ - 1, std::forward<Args>(args)...);
+            data_--;
+        }
+        size_++;
+        return data_[0];
+    }
+    void PopBack() {
+        if(!Empty()) {
+            Destroy(data_ + size_ - 1);
+            size_--;
+        }
+    }
+    void PopFront() {
+        if(!Empty()) {
+            Destroy(data_);
+            data_++;
+            size_--;
+        }
+    }
+    template<typename InputIt>
+    void Append(InputIt first, InputIt last) {
+        InsertRange(size_, first, last);
+    }
+    // * 在索引pos之前插入[first, last)。forward iterator可以事先算出插入後的大小，因此最多只重新配置一次：
+    //   容量不足時直接在新緩衝區上把區間建構在最終位置，再把原本的前後兩段搬到它的兩側；容量足夠時先接在尾端
+    //   建構，再rotate到pos。區間參考到自身元素也沒關係，因為舊元素在新區間建構完成之前都不會被搬動。
+    //   單趟(input iterator)的區間無法事先得知長度，只能逐一EmplaceBack後再rotate。
+    template<typename InputIt>
+    void InsertRange(std::size_t pos, InputIt first, InputIt last) {
+        using Category = typename std::iterator_traits<InputIt>::iterator_category;
+        std::size_t old_size = size_;
+        if constexpr(std::is_base_of_v<std::forward_iterator_tag, Category>) {
+            std::size_t n = std::distance(first, last);
+            if(n == 0) return;
+            if(n > MaxSize() - size_) throw std::length_error("Vector Too Large");
+            if(size_ + n > BackCapacity()) {
+                std::size_t new_capacity = Grow(size_ + n);
+                T* tmp = Allocate(new_capacity);
+                try {
+                    CopyConstruct(first, n, tmp + pos);
+                } catch(...) {
+                    Deallocate(tmp, new_capacity);
+                    throw;
+                }
+                try {
+                    Relocate(data_, pos, tmp);
+                } catch(...) {
+                    Destroy(tmp + pos, tmp + pos + n);
+                    Deallocate(tmp, new_capacity);
+                    throw;
+                }
+                try {
+                    Relocate(data_ + pos, size_ - pos, tmp + pos + n);
+                } catch(...) {                  // * 只有退回複製的情況會拋出例外，此時舊元素仍然完整。
+                    Destroy(tmp, tmp + pos + n);
+                    Deallocate(tmp, new_capacity);
+                    throw;
+                }
+                Adopt(tmp, new_capacity, 0);
+                size_ += n;
+                return;
+            }
+            CopyConstruct(first, n, data_ + size_);
+            size_ += n;
+        } else {
+            for(; first != last; ++first) {
+                EmplaceBack(*first);
+            }
+        }
+        std::rotate(data_ + pos, data_ + old_size, data_ + size_);
+    }
+    T& Back() {
+        return data_[size_-1];
+    }
+    const T& Back() const {
+        return data_[size_-1];
+    }
+    T& Front() {
+        return data_[0];
+    }
+    const T& Front() const {
+        return data_[0];
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    void Fill(const T& val) {
+        simd::Fill(data_, size_, val);
+    }
+    // * 回傳第一個等於val的元素索引，找不到時回傳npos。
+    std::size_t Find(const T& val) const {
+        std::size_t id = simd::Find<T>(data_, size_, val);
+        return id == size_ ? npos : id;
+    }
+    std::size_t Count(const T& val) const {
+        return simd::Count<T>(data_, size_, val);
+    }
+    // * Min/Max要求Vector不是空的(與Front()/Back()相同)。
+    T Min() const {
+        return simd::Min<T>(data_, size_);
+    }
+    T Max() const {
+        return simd::Max<T>(data_, size_);
+    }
+    T Sum() const {
+        return simd::Sum<T>(data_, size_);
+    }
+    T Dot(const Vector& other) const {
+        return simd::Dot<T>(data_, other.data_, std::min(size_, other.size_));
+    }
+    void Swap(Vector& other) {
+        SwapStorage(other);                     // * 直接交換內部資源；比起std::swap(other, *this)所觸發的一次移動建構
+        if constexpr(AllocTraits::propagate_on_container_swap::value) { // 加上兩次移動賦值還要更省事，且與T無關。
+            std::swap(other.alloc_, alloc_);
+        }
+    }
+    using Iterator = ContiguousIterator<T>;
+    using ConstIterator = ContiguousIterator<const T>;
+    Iterator Begin() {
+        return {data_};
+    }
+    ConstIterator Begin() const {
+        return {data_};
+    }
+    Iterator End() {
+        return {data_ + size_};
+    }
+    ConstIterator End() const {
+        return {data_ + size_};
+    }
+    // * 標準容器介面的名稱，讓range-based for、std::size、std::data以及標準演算法可以直接使用。
+    T* data() {
+        return data_;
+    }
+    const T* data() const {
+        return data_;
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    Iterator begin() {
+        return Begin();
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    Iterator end() {
+        return End();
+    }
+    ConstIterator end() const {
+        return End();
+    }
+  private:
+    // * 只配置原始記憶體(raw storage)而不建構任何元素，元素一律透過AllocTraits::construct在需要時才建構，
+    //   避免new T[n] {}把整塊容量都做一次值初始化(value-initialization)。
+    //   使用預設配置器且對齊需求不超過max_align_t的型別改用malloc/free，才能在逐位元組搬移時改用realloc。
+    static constexpr bool kUseMalloc = std::is_same_v<Allocator, std::allocator<T>> &&
+                                       alignof(T) <= alignof(std::max_align_t);
+    static constexpr bool kBitwiseRelocatable = IsTriviallyRelocatable<T>::value;
+    static constexpr bool kPlainConstruct = UsesPlainConstruct<Allocator, T>::value;
+    // * 至少kHugePageThreshold bytes的緩衝區以2 MiB對齊配置，並以madvise(MADV_HUGEPAGE)要求透明大分頁(THP)：
+    //   一個TLB項目就涵蓋2 MiB而不是4 KiB，掃描數十GB的Vector時TLB miss大幅減少。這只是提示，核心沒有開啟THP時照常使用一般分頁。
+    static constexpr std::size_t kHugePageSize = std::size_t{1} << 21;
+    static constexpr std::size_t kHugePageThreshold = 8 * kHugePageSize;
+    static void AdviseHugePages(void* ptr, std::size_t bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if(bytes < kHugePageThreshold) return;
+        std::uintptr_t first = (reinterpret_cast<std::uintptr_t>(ptr) + kHugePageSize - 1) & ~(kHugePageSize - 1);
+        std::uintptr_t last = (reinterpret_cast<std::uintptr_t>(ptr) + bytes) & ~(kHugePageSize - 1);
+        if(first < last) ::madvise(reinterpret_cast<void*>(first), last - first, MADV_HUGEPAGE);
+#else
+        (void)ptr;
+        (void)bytes;
+#endif
+    }
+    T* Allocate(std::size_t n) {
+        if(n == 0) return nullptr;
+        if constexpr(kUseMalloc) {
+            std::size_t bytes = sizeof(T) * n;
+            void* ptr = bytes < kHugePageThreshold ? std::malloc(bytes)
+                      : std::aligned_alloc(kHugePageSize, (bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize);
+            if(!ptr) throw std::bad_alloc();
+            AdviseHugePages(ptr, bytes);
+            return static_cast<T*>(ptr);
+        } else {
+            return AllocTraits::allocate(alloc_, n);
+        }
+    }
+    void Deallocate(T* ptr, std::size_t n) {
+        if(!ptr) return;
+        if constexpr(kUseMalloc) {
+            std::free(ptr);
+        } else {
+            AllocTraits::deallocate(alloc_, ptr, n);
+        }
+    }
+    void SwapStorage(Vector& other) {
+        std::swap(other.buffer_, buffer_);
+        std::swap(other.data_, data_);
+        std::swap(other.size_, size_);
+        std::swap(other.capacity_, capacity_);
+        TrackCapacity();                        // * 統計資料屬於容器物件本身，不隨緩衝區交換。
+        other.TrackCapacity();
+    }
+    // * 單一元素的建構與解構一律經過配置器。
+    template<typename... Args>
+    void Construct(T* ptr, Args&&... args) {
+        AllocTraits::construct(alloc_, ptr, std::forward<Args>(args)...);
+    }
+    void Destroy(T* ptr) {
+        AllocTraits::destroy(alloc_, ptr);
+    }
+    void Destroy(T* first, T* last) {
+        if constexpr(kPlainConstruct) {
+            std::destroy(first, last);
+        } else {
+            for(; first != last; ++first) {
+                AllocTraits::destroy(alloc_, first);
+            }
+        }
+    }
+    // * 在未初始化的dst上複製建構n個元素；來源是指向T的指標且T為trivially copyable時直接整塊memcpy。
+    //   配置器自訂了construct時逐一建構，途中拋出例外就解構已建構的元素再重新拋出。
+    template<typename InputIt>
+    void CopyConstruct(InputIt src, std::size_t n, T* dst) {
+        if constexpr(kPlainConstruct && std::is_trivially_copyable_v<T> && std::is_pointer_v<InputIt> &&
+                     std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>) {
+            if(n) std::memcpy(dst, src, sizeof(T) * n);
+        } else if constexpr(kPlainConstruct) {
+            std::uninitialized_copy_n(src, n, dst);
+        } else {
+            std::size_t built = 0;
+            try {
+                for(; built < n; built++, ++src) {
+                    Construct(dst + built, *src);
+                }
+            } catch(...) {
+                Destroy(dst, dst + built);
+                throw;
+            }
+        }
+    }
+    void ValueConstruct(T* dst, std::size_t n) {
+        if constexpr(kPlainConstruct) {
+            std::uninitialized_value_construct_n(dst, n);
+        } else {
+            std::size_t built = 0;
+            try {
+                for(; built < n; built++) {
+                    Construct(dst + built);
+                }
+            } catch(...) {
+                Destroy(dst, dst + built);
+                throw;
+            }
+        }
+    }
+    // * 將[src, src+n)搬到未初始化的dst上。可逐位元組搬移的型別直接memcpy；否則若T的移動建構子為noexcept就移動，
+    //   不然改用複製(move_if_noexcept)，使得途中拋出例外時原本的緩衝區仍然完整(strong exception guarantee)，
+    //   dst上已建構的元素會被自動解構。來源元素留給呼叫端(Adopt)解構。
+    void Relocate(T* src, std::size_t n, T* dst) {
+        if constexpr(kBitwiseRelocatable) {
+            if(n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), sizeof(T) * n);
+        } else if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+            CopyConstruct(std::make_move_iterator(src), n, dst);
+        } else {
+            CopyConstruct(src, n, dst);
+        }
+    }
+    // * 前端保留的未初始化空間，以及從data_起算到緩衝區結尾還能放幾個元素。
+    std::size_t FrontGap() const {
+        return data_ - buffer_;
+    }
+    std::size_t BackCapacity() const {
+        return capacity_ - FrontGap();
+    }
+    // * 某一端沒有空間、但元素不到容量的一半時，不必重新配置：把元素在原緩衝區內移到中央，兩端各留下至少
+    //   (capacity_ - size_) / 2 >= capacity_ / 4個空位，移動size_個元素的成本因此攤銷為每次操作O(1)。
+    //   佇列式的使用(PushBack + PopFront)容量會維持在元素個數的兩倍左右，而不是每繞一圈就加倍。
+    //   原地移動中途不能失敗，因此只用在可以逐位元組搬移或移動建構子為noexcept的型別。
+    bool CanRecenter() const {
+        return (kBitwiseRelocatable || std::is_nothrow_move_constructible_v<T>) && size_ < capacity_ && 2 * size_ <= capacity_;
+    }
+    void Recenter() {
+        T* dst = buffer_ + (capacity_ - size_) / 2;
+        if(dst == data_) return;
+        if constexpr(kBitwiseRelocatable) {
+            if(size_) std::memmove(static_cast<void*>(dst), static_cast<const void*>(data_), sizeof(T) * size_);
+        } else if(dst < data_) {                // * 往前移時由前往後、往後移時由後往前，目的位置不是空的就是已經移走的元素。
+            for(std::size_t i = 0; i < size_; i++) {
+                Construct(dst + i, std::move(data_[i]));
+                Destroy(data_ + i);
+            }
+        } else {
+            for(std::size_t i = size_; i-- > 0;) {
+                Construct(dst + i, std::move(data_[i]));
+                Destroy(data_ + i);
+            }
+        }
+        data_ = dst;
+    }
+    // * 逐元素的運算只讀寫同一個位置，因此運算式中出現*this本身(例如a = a * 2 + b)也沒關係。
+    template<typename E>
+    void Assign(const E& e) {
+        std::size_t n = e.Size();
+        Resize(n);
+        T* out = data_;
+        for(std::size_t i = 0; i < n; i++) {
+            out[i] = e[i];
+        }
+    }
+    // * 容量不足、至少要放得下required個元素時，由成長策略決定新的容量。成長的基準是實際的元素個數size_
+    //   而不是capacity_：前端或後端保留了大量空位時，新容量仍然只與元素個數成比例。
+    //   成長策略看到的大小不超過MaxSize()/2，2倍或1.5倍的計算不會溢位；結果再夾回[required, MaxSize()]之間。
+    std::size_t Grow(std::size_t required) const {
+        if(required > MaxSize()) throw std::length_error("Vector Too Large");
+        std::size_t next = Growth::Next(std::min(size_, MaxSize() / 2), required, sizeof(T));
+        return std::min(std::max(next, required), MaxSize());
+    }
+    // * 記錄一次換緩衝區(搬移了現有的size_個元素)；沒有開啟統計時整個函式是空的。
+    void TrackReallocation() {
+        if constexpr(Growth::kTrackStats) {
+            stats_.reallocations++;
+            stats_.bytes_moved += sizeof(T) * size_;
+        }
+        TrackCapacity();
+    }
+    void TrackCapacity() {
+        if constexpr(Growth::kTrackStats) {
+            stats_.peak_capacity = std::max<std::size_t>(stats_.peak_capacity, capacity_);
+        }
+    }
+    // * 解構舊元素並改用已搬好元素的新緩衝區；逐位元組搬移過的舊元素視同已解構。
+    void Adopt(T* tmp, std::size_t new_capacity, std::size_t new_front) {
+        if constexpr(!kBitwiseRelocatable) {
+            Destroy(data_, data_ + size_);
+        }
+        Deallocate(buffer_, capacity_);
+        buffer_ = tmp;
+        data_ = tmp + new_front;
+        capacity_ = new_capacity;
+        TrackReallocation();
+    }
+    // * 重新配置new_capacity個元素的緩衝區，並把現有元素放在前端保留new_front個空位之後。
+    void Reallocate(std::size_t new_capacity, std::size_t new_front = 0) {
+        if constexpr(kBitwiseRelocatable && kUseMalloc) {
+            if(FrontGap() == 0 && new_front == 0) {
+                // * 交給realloc：能原地擴張時完全不用搬移；glibc對大型(以mmap配置的)區塊會改用mremap重新映射分頁，
+                //   即使是GB等級的緩衝區也不需要逐位元組複製。
+                void* ptr = std::realloc(static_cast<void*>(buffer_), sizeof(T) * new_capacity);
+                if(!ptr) throw std::bad_alloc();
+                AdviseHugePages(ptr, sizeof(T) * new_capacity); // * realloc之後不一定保持2 MiB對齊，但其中對齊的2 MiB區段仍可使用大分頁。
+                buffer_ = data_ = static_cast<T*>(ptr);
+                capacity_ = new_capacity;
+                TrackReallocation();
+                return;
+            }
+        }
+        T* tmp = Allocate(new_capacity);
+        try {
+            Relocate(data_, size_, tmp + new_front);
+        } catch(...) {
+            Deallocate(tmp, new_capacity);
+            throw;
+        }
+        Adopt(tmp, new_capacity, new_front);
+    }
+    // * 重新配置並同時以args在新緩衝區的slot位置建構一個新元素，現有元素搬到elements_at開始的位置。
+    //   新元素先建構，因此args參考到舊緩衝區中的元素也沒關係。
+    template<typename... Args>
+    void ReallocateWith(std::size_t new_capacity, std::size_t elements_at, std::size_t slot, Args&&... args) {
+        T* tmp = Allocate(new_capacity);
+        try {
+            Construct(tmp + slot, std::forward<Args>(args)...);
+        } catch(...) {
+            Deallocate(tmp, new_capacity);
+            throw;
+        }
+        try {
+            Relocate(data_, size_, tmp + elements_at);
+        } catch(...) {
+            Destroy(tmp + slot);
+            Deallocate(tmp, new_capacity);
+            throw;
+        }
+        Adopt(tmp, new_capacity, std::min(elements_at, slot));
+    }
+    T* buffer_{};
+    std::size_t size_{};
+    std::size_t capacity_{};
+    T* data_{};
+    Allocator alloc_{};
+    struct NoStats{};
+    std::conditional_t<Growth::kTrackStats, VectorStats, NoStats> stats_{};
+};
+
+// * Vector本身只持有指向heap的指標，沒有指向自己的指標，因此只要配置器也可以逐位元組搬移，
+//   Vector<Vector<T>>在擴充時就只需memcpy。
+template<typename T, typename Allocator, typename Growth>
+struct IsTriviallyRelocatable<Vector<T, Allocator, Growth>>: IsTriviallyRelocatable<Allocator> {};
+template<typename T, typename Allocator, typename Growth>
+struct expr::IsTerminal<Vector<T, Allocator, Growth>>: std::true_type {};
+
+// * Template Specialization (for bool)：每個元素只佔1 bit，以64-bit的word為單位存放，20億個旗標只需要250 MB。
+//   Count、FindFirst/FindNext、And/Or/Xor、Fill等操作都一次處理一整個word(64個元素)。
+//   元素無法單獨取址，operator[]回傳代理物件Reference，行為與std::vector<bool>相同。
+//   最後一個word中超過size_的位元一律保持為0，Count與比較時就不必另外遮罩。
+template<typename Allocator, typename Growth>
+class Vector<bool, Allocator, Growth>{
+    using Word = std::uint64_t;
+    using WordAlloc = typename std::allocator_traits<Allocator>::template rebind_alloc<Word>;
+    using WordTraits = std::allocator_traits<WordAlloc>;
+    static constexpr std::size_t kWordBits = 64;
+  public:
+    using value_type = bool;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    // * FindFirst/FindNext找不到時的回傳值。
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    class Reference{
+      public:
+        Reference(Word* word, Word mask): word_(word), mask_(mask) {}
+        operator bool() const {
+            return (*word_ & mask_) != 0;
+        }
+        Reference& operator=(bool val) {
+            if(val) {
+                *word_ |= mask_;
+            } else {
+                *word_ &= ~mask_;
+            }
+            return *this;
+        }
+        Reference& operator=(const Reference& other) {
+            return *this = static_cast<bool>(other);
+        }
+        void Flip() {
+            *word_ ^= mask_;
+        }
+        // * 交換兩個代理物件所指的位元(而不是代理物件本身)，std::sort、std::reverse等演算法靠它交換元素。
+        friend void swap(Reference a, Reference b) noexcept {
+            bool tmp = a;
+            a = static_cast<bool>(b);
+            b = tmp;
+        }
+      private:
+        Word* word_;
+        Word mask_;
+    };
+    Vector() = default;
+    explicit Vector(const Allocator& alloc): alloc_(alloc) {}
+    Vector(std::size_t size, bool val = false, const Allocator& alloc = Allocator()): alloc_(alloc) {
+        Resize(size, val);
+    }
+    // * 由bool的運算式(例如Less(a, b))建構遮罩，每64個結果組成一個word後一次寫入。
+    template<typename E>
+    Vector(const expr::Expr<E>& e, const Allocator& alloc = Allocator()): alloc_(alloc) {
+        Assign(e.Self());
+    }
+    template<typename E>
+    Vector& operator=(const expr::Expr<E>& e) {
+        Assign(e.Self());
+        return *this;
+    }
+    Vector(const std::initializer_list<bool> lst, const Allocator& alloc = Allocator()): alloc_(alloc) {
+        Reserve(lst.size());
+        for(bool val: lst) {
+            PushBack(val);
+        }
+    }
+    Vector(const Vector& other): alloc_(WordTraits::select_on_container_copy_construction(other.alloc_)) {
+        Reserve(other.size_);
+        if(other.size_) std::memcpy(words_, other.words_, sizeof(Word) * Words(other.size_));
+        size_ = other.size_;
+    }
+    Vector& operator=(const Vector& other) {
+        if(&other == this) return *this;
+        if constexpr(WordTraits::propagate_on_container_copy_assignment::value) {
+            if(alloc_ != other.alloc_) Release();
+            alloc_ = other.alloc_;
+        }
+        size_ = 0;
+        Reserve(other.size_);
+        if(other.size_) std::memcpy(words_, other.words_, sizeof(Word) * Words(other.size_));
+        size_ = other.size_;
+        return *this;
+    }
+    Vector(Vector&& other) noexcept: alloc_(std::move(other.alloc_)) {
+        SwapStorage(other);
+    }
+    Vector& operator=(Vector&& other) noexcept(WordTraits::propagate_on_container_move_assignment::value ||
+                                               WordTraits::is_always_equal::value) {
+        if(&other == this) return *this;
+        if constexpr(!WordTraits::propagate_on_container_move_assignment::value && !WordTraits::is_always_equal::value) {
+            if(alloc_ != other.alloc_) return *this = other; // * 配置器不同時無法接手對方的緩衝區，只能複製。
+        }
+        Release();
+        if constexpr(WordTraits::propagate_on_container_move_assignment::value) {
+            alloc_ = std::move(other.alloc_);
+        }
+        SwapStorage(other);
+        return *this;
+    }
+    ~Vector() {
+        Release();
+    }
+    Reference operator[](std::size_t id) {
+        return {words_ + id / kWordBits, Word{1} << (id % kWordBits)};
+    }
+    bool operator[](std::size_t id) const {
+        return (words_[id / kWordBits] >> (id % kWordBits)) & 1;
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    std::size_t Capacity() const {
+        return capacity_words_ * kWordBits;
+    }
+    // * 能存放的最大元素個數：配置器能配置的word數乘上64，並且不超過size_t能表示的範圍。
+    std::size_t MaxSize() const {
+        return std::min<std::size_t>(WordTraits::max_size(alloc_), std::numeric_limits<std::size_t>::max() / kWordBits) * kWordBits;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    const VectorStats& Stats() const {
+        static_assert(Growth::kTrackStats, "use growth::Tracked<Policy> to enable reallocation statistics");
+        return stats_;
+    }
+    void Reserve(std::size_t new_capacity) {
+        if(new_capacity > MaxSize()) throw std::length_error("Vector Too Large");
+        if(Words(new_capacity) > capacity_words_) Reallocate(Words(new_capacity));
+    }
+    void Resize(std::size_t new_size, bool val = false) {
+        if(new_size > Capacity()) {
+            Reallocate(Grow(new_size));
+        }
+        if(new_size > size_) {
+            std::size_t first = size_;
+            std::size_t tail = first % kWordBits;
+            std::size_t word = first / kWordBits;
+            if(tail) {                          // * 先補滿目前最後一個word，其餘整個word一次寫入。
+                if(val) words_[word] |= ~Word{0} << tail;
+                word++;
+            }
+            if(Words(new_size) > word) std::memset(words_ + word, val ? 0xff : 0, sizeof(Word) * (Words(new_size) - word));
+        }
+        size_ = new_size;
+        ClearTail();
+    }
+    void Clear() {
+        size_ = 0;
+    }
+    void PushBack(bool val) {
+        if(size_ == Capacity()) {
+            Reallocate(Grow(size_ + 1));
+        }
+        if(size_ % kWordBits == 0) words_[size_ / kWordBits] = 0;
+        size_++;
+        (*this)[size_-1] = val;
+    }
+    void PopBack() {
+        if(!Empty()) {
+            size_--;
+            ClearTail();
+        }
+    }
+    Reference Front() {
+        return (*this)[0];
+    }
+    bool Front() const {
+        return (*this)[0];
+    }
+    Reference Back() {
+        return (*this)[size_-1];
+    }
+    bool Back() const {
+        return (*this)[size_-1];
+    }
+    void Fill(bool val) {
+        if(Empty()) return;
+        std::memset(words_, val ? 0xff : 0, sizeof(Word) * Words(size_));
+        ClearTail();
+    }
+    // * 把所有元素反轉。
+    void Flip() {
+        for(std::size_t i = 0; i < Words(size_); i++) {
+            words_[i] = ~words_[i];
+        }
+        ClearTail();
+    }
+    // * 值為true的元素個數，每個word一個popcount指令。
+    std::size_t Count() const {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < Words(size_); i++) {
+            count += __builtin_popcountll(words_[i]);
+        }
+        return count;
+    }
+    std::size_t Count(bool val) const {
+        return val ? Count() : size_ - Count();
+    }
+    // * 第一個等於val的元素索引；整個word都不符合時直接跳過64個元素。
+    std::size_t FindFirst(bool val = true) const {
+        return FindFrom(0, val);
+    }
+    // * pos之後(不含pos)第一個等於val的元素索引。
+    std::size_t FindNext(std::size_t pos, bool val = true) const {
+        return FindFrom(pos + 1, val);
+    }
+    // * 逐word的位元運算，兩邊的大小必須相同。
+    Vector& And(const Vector& other) {
+        return Combine(other, [](Word a, Word b) { return a & b; });
+    }
+    Vector& Or(const Vector& other) {
+        return Combine(other, [](Word a, Word b) { return a | b; });
+    }
+    Vector& Xor(const Vector& other) {
+        return Combine(other, [](Word a, Word b) { return a ^ b; });
+    }
+    void Swap(Vector& other) {
+        SwapStorage(other);
+        if constexpr(WordTraits::propagate_on_container_swap::value) {
+            std::swap(other.alloc_, alloc_);
+        }
+    }
+    // * 以索引表示位置的迭代器；Const為false時解參考得到Reference。提供random access iterator的完整介面，
+    //   Iterator可以隱式轉成ConstIterator。
+    template<bool Const>
+    class BitIterator{
+        using Owner = std::conditional_t<Const, const Vector, Vector>;
+        friend class BitIterator<!Const>;
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, bool, Reference>;
+        BitIterator() = default;
+        BitIterator(Owner* vec, std::size_t id): vec_(vec), id_(id) {}
+        template<bool C = Const, typename = std::enable_if_t<C>>
+        BitIterator(const BitIterator<false>& other): vec_(other.vec_), id_(other.id_) {}
+        reference operator*() const {
+            return (*vec_)[id_];
+        }
+        reference operator[](difference_type n) const {
+            return (*vec_)[id_ + n];
+        }
+        BitIterator& operator++() {
+            ++id_;
+            return *this;
+        }
+        BitIterator operator++(int) {
+            return {vec_, id_++};
+        }
+        BitIterator& operator--() {
+            --id_;
+            return *this;
+        }
+        BitIterator operator--(int) {
+            return {vec_, id_--};
+        }
+        BitIterator& operator+=(difference_type n) {
+            id_ += n;
+            return *this;
+        }
+        BitIterator& operator-=(difference_type n) {
+            id_ -= n;
+            return *this;
+        }
+        friend BitIterator operator+(BitIterator it, difference_type n) {
+            return it += n;
+        }
+        friend BitIterator operator+(difference_type n, BitIterator it) {
+            return it += n;
+        }
+        friend BitIterator operator-(BitIterator it, difference_type n) {
+            return it -= n;
+        }
+        friend difference_type operator-(const BitIterator& a, const BitIterator& b) {
+            return static_cast<difference_type>(a.id_) - static_cast<difference_type>(b.id_);
+        }
+        friend bool operator==(const BitIterator& a, const BitIterator& b) {
+            return a.id_ == b.id_;
+        }
+        friend bool operator!=(const BitIterator& a, const BitIterator& b) {
+            return a.id_ != b.id_;
+        }
+        friend bool operator<(const BitIterator& a, const BitIterator& b) {
+            return a.id_ < b.id_;
+        }
+        friend bool operator>(const BitIterator& a, const BitIterator& b) {
+            return a.id_ > b.id_;
+        }
+        friend bool operator<=(const BitIterator& a, const BitIterator& b) {
+            return a.id_ <= b.id_;
+        }
+        friend bool operator>=(const BitIterator& a, const BitIterator& b) {
+            return a.id_ >= b.id_;
+        }
+      private:
+        Owner* vec_{};
+        std::size_t id_{};
+    };
+    using Iterator = BitIterator<false>;
+    using ConstIterator = BitIterator<true>;
+    Iterator Begin() {
+        return {this, 0};
+    }
+    ConstIterator Begin() const {
+        return {this, 0};
+    }
+    Iterator End() {
+        return {this, size_};
+    }
+    ConstIterator End() const {
+        return {this, size_};
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    Iterator begin() {
+        return Begin();
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    Iterator end() {
+        return End();
+    }
+    ConstIterator end() const {
+        return End();
+    }
+  private:
+    static std::size_t Words(std::size_t bits) {
+        return (bits + kWordBits - 1) / kWordBits;
+    }
+    // * 與Vector::Grow相同，回傳的是word數：超過MaxSize()時拋出例外，成長策略看到的容量不超過上限的一半，
+    //   結果再夾回[所需word數, 最大word數]之間，Words與容量的計算都不會溢位。
+    std::size_t Grow(std::size_t required) const {
+        if(required > MaxSize()) throw std::length_error("Vector Too Large");
+        std::size_t max_words = MaxSize() / kWordBits;
+        std::size_t next = Growth::Next(std::min(capacity_words_, max_words / 2), Words(required), sizeof(Word));
+        return std::min(std::max(next, Words(required)), max_words);
+    }
+    template<typename E>
+    void Assign(const E& e) {
+        std::size_t n = e.Size();
+        Resize(n);
+        for(std::size_t w = 0; w < Words(n); w++) {
+            Word word = 0;
+            std::size_t first = w * kWordBits;
+            std::size_t last = std::min(n, first + kWordBits);
+            for(std::size_t i = first; i < last; i++) {
+                word |= static_cast<Word>(static_cast<bool>(e[i])) << (i - first);
+            }
+            words_[w] = word;
         }
     }
-    Vector(const Vector& other) {
-        data_ = new T[other.size_] {};
-        for(int i = 0; i < other.size_; i++) {
-            data_[i] = other.data_[i];
+    void SwapStorage(Vector& other) {
+        std::swap(other.words_, words_);
+        std::swap(other.size_, size_);
+        std::swap(other.capacity_words_, capacity_words_);
+    }
+    void Release() {
+        if(words_) WordTraits::deallocate(alloc_, words_, capacity_words_);
+        words_ = nullptr;
+        size_ = capacity_words_ = 0;
+    }
+    // * 把最後一個word中超過size_的位元清為0。
+    void ClearTail() {
+        if(size_ % kWordBits) words_[size_ / kWordBits] &= (Word{1} << (size_ % kWordBits)) - 1;
+    }
+    void Reallocate(std::size_t new_words) {
+        Word* tmp = WordTraits::allocate(alloc_, new_words);
+        if(words_) {
+            std::memcpy(tmp, words_, sizeof(Word) * Words(size_));
+            WordTraits::deallocate(alloc_, words_, capacity_words_);
         }
-        size_ = other.size_;
-        capacity_ = other.capacity_;
+        if constexpr(Growth::kTrackStats) {
+            stats_.reallocations++;
+            stats_.bytes_moved += sizeof(Word) * Words(size_);
+            stats_.peak_capacity = std::max(stats_.peak_capacity, new_words * kWordBits);
+        }
+        words_ = tmp;
+        capacity_words_ = new_words;
     }
-    Vector& operator=(const Vector& other) {
-        if(&other == this) return *this;
-        if(data_) delete [] data_;
-        data_ = new T[other.capacity_] {};
-        for(int i = 0; i < other.size_; i++){
-            data_[i] = other.data_[i];
+    std::size_t FindFrom(std::size_t pos, bool val) const {
+        if(pos >= size_) return npos;
+        Word flip = val ? 0 : ~Word{0};         // * 找0時先反轉word，問題就變成找第一個1。
+        std::size_t i = pos / kWordBits;
+        Word word = (words_[i] ^ flip) & (~Word{0} << (pos % kWordBits));
+        while(!word) {
+            if(++i == Words(size_)) return npos;
+            word = words_[i] ^ flip;
+        }
+        std::size_t id = i * kWordBits + __builtin_ctzll(word);
+        return id < size_ ? id : npos;          // * 找0時反轉後的尾端位元是1，要排除。
+    }
+    template<typename Op>
+    Vector& Combine(const Vector& other, Op op) {
+        if(other.size_ != size_) throw std::invalid_argument("Vector Size Mismatch");
+        for(std::size_t i = 0; i < Words(size_); i++) {
+            words_[i] = op(words_[i], other.words_[i]);
         }
-        size_ = other.size_;
-        capacity_ = other.size_;
         return *this;
     }
-    Vector(Vector&& other) {
-        data_ = other.data_;
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-        other.data_ = nullptr;
-        other.size_ = 0;
-        other.capacity_ = 0;
+    Word* words_{};
+    std::size_t size_{};
+    std::size_t capacity_words_{};
+    WordAlloc alloc_{};
+    struct NoStats{};
+    std::conditional_t<Growth::kTrackStats, VectorStats, NoStats> stats_{};
+};
+
+template<typename T, typename Allocator, typename Growth>
+typename Vector<T, Allocator, Growth>::ConstIterator Begin(const Vector<T, Allocator, Growth>& vec) {
+    return vec.Begin();
+}
+template<typename T, typename Allocator, typename Growth>
+typename Vector<T, Allocator, Growth>::ConstIterator End(const Vector<T, Allocator, Growth>& vec) {
+    return vec.End();
+}
+template<typename T, typename Allocator, typename Growth>
+typename Vector<T, Allocator, Growth>::Iterator Begin(Vector<T, Allocator, Growth>& vec) {
+    return vec.Begin();
+}
+template<typename T, typename Allocator, typename Growth>
+typename Vector<T, Allocator, Growth>::Iterator End(Vector<T, Allocator, Growth>& vec) {
+    return vec.End();
+}
+
+// * 容器之間的比較：==比較大小與每個元素，<為字典序，與std::vector相同，結果是bool。
+template<typename T, typename Allocator, typename Growth>
+bool operator==(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return a.Size() == b.Size() && std::equal(a.begin(), a.end(), b.begin());
+}
+template<typename T, typename Allocator, typename Growth>
+bool operator!=(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return !(a == b);
+}
+template<typename T, typename Allocator, typename Growth>
+bool operator<(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+}
+template<typename T, typename Allocator, typename Growth>
+bool operator>(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return b < a;
+}
+template<typename T, typename Allocator, typename Growth>
+bool operator<=(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return !(b < a);
+}
+template<typename T, typename Allocator, typename Growth>
+bool operator>=(const Vector<T, Allocator, Growth>& a, const Vector<T, Allocator, Growth>& b) {
+    return !(a < b);
+}
+
+template<typename T, typename Allocator, typename Growth>
+std::ostream& operator<<(std::ostream& os, const Vector<T, Allocator, Growth>& vec) {
+    os << "[";
+    // for(int i = 0; i < vec.size_; i++) {
+    //     if(i != 0) os << ", ";
+    //     os << vec[i];
+    // }
+    for(typename Vector<T, Allocator, Growth>::ConstIterator it = Begin(vec); it != End(vec); it++) {
+        if(it != Begin(vec)) os << ", ";
+        os << *it;
     }
-    Vector& operator=(Vector&& other) {
-        if(&other == this) return *this;
-        if(data_) delete [] data_;
-        data_ = other.data_;
-        size_ = other.size_;
-        capacity_ = other.capacity_;
-        other.data_ = nullptr;
-        other.size_ = 0;
-        other.capacity_ = 0;
-        return *this;
+    os << "]";
+    return os;
+}
+
+// * ThreadPool: 可重複使用的work-stealing執行緒池。每個worker有自己的工作佇列，從自己的佇列尾端取工作(LIFO，
+//   剛切出來的子工作還在cache裡)，自己的佇列空了才從其他worker佇列的前端偷工作(FIFO，偷到的通常是較大塊的工作)。
+class ThreadPool{
+  public:
+    explicit ThreadPool(int threads = std::max(1u, std::thread::hardware_concurrency())) {
+        for(int i = 0; i < threads; i++) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        for(int i = 0; i < threads; i++) {
+            workers_.emplace_back([this, i] { WorkerLoop(i); });
+        }
     }
-    ~Vector() {
-        delete [] data_;
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(idle_mtx_);
+            stop_ = true;
+        }
+        idle_cv_.notify_all();
+        for(std::thread& worker: workers_) {
+            worker.join();
+        }
     }
-    T& operator[](int id) {
-        return data_[id];
+    int Size() const {
+        return workers_.size();
     }
-    const T& operator[](int id) const {
-        return data_[id];
+    // * 在worker上提交的工作放進該worker自己的佇列，其他執行緒提交的工作則輪流分配。
+    void Submit(std::function<void()> task) {
+        int id = current_pool_ == this ? current_id_ : next_++ % queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(queues_[id]->mtx);
+            queues_[id]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(idle_mtx_);
+            pending_++;
+        }
+        idle_cv_.notify_one();
     }
-    void Resize(int new_size) {
-        if(new_size > capacity_) {
-            capacity_ = 2*(new_size+1);
-            T* tmp = new T[capacity_] {};
-            if(data_) {
-                for(int i = 0; i < size_; i++) {
-                    tmp[i] = data_[i];
-                }
-                delete [] data_;
+    // * 取出並執行一個工作；等待中的執行緒(TaskGroup::Wait)藉此幫忙消化工作，巢狀的平行呼叫才不會互相卡死。
+    bool RunPendingTask() {
+        std::function<void()> task;
+        if(!TryPop(current_pool_ == this ? current_id_ : 0, task)) return false;
+        task();
+        return true;
+    }
+  private:
+    struct Queue{
+        std::mutex mtx;
+        std::deque<std::function<void()>> tasks;
+    };
+    bool TryPop(int id, std::function<void()>& task) {
+        int n = queues_.size();
+        for(int k = 0; k < n; k++) {
+            Queue& q = *queues_[(id + k) % n];
+            std::lock_guard<std::mutex> lock(q.mtx);
+            if(q.tasks.empty()) continue;
+            if(k == 0) {
+                task = std::move(q.tasks.back());
+                q.tasks.pop_back();
+            } else {
+                task = std::move(q.tasks.front());
+                q.tasks.pop_front();
             }
-            data_ = tmp;
-            size_ = new_size;
-            return;
+            pending_--;
+            return true;
         }
-        if(new_size < size_) {
-            for(int i = new_size; i < size_; i++) {
-                data_[i] = T{};
+        return false;
+    }
+    void WorkerLoop(int id) {
+        current_pool_ = this;
+        current_id_ = id;
+        while(true) {
+            std::function<void()> task;
+            if(TryPop(id, task)) {
+                task();
+                continue;
             }
+            std::unique_lock<std::mutex> lock(idle_mtx_);
+            idle_cv_.wait(lock, [this] { return stop_ || pending_ > 0; });
+            if(stop_ && pending_ == 0) return;
         }
-        size_ = new_size;
     }
-    void PushBack(const T& val) {
-        int insert_id = size_;
-        Resize(size_+1);
-        data_[insert_id] = val;
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::mutex idle_mtx_;
+    std::condition_variable idle_cv_;
+    std::atomic<int> pending_{0};
+    std::atomic<unsigned> next_{0};
+    bool stop_{false};
+    static inline thread_local ThreadPool* current_pool_ = nullptr;
+    static inline thread_local int current_id_ = 0;
+};
+
+// * 一組提交到ThreadPool的工作；Wait()會在等待期間幫忙執行池中的工作，並重新拋出第一個工作中發生的例外。
+//   池中沒有工作可以幫忙時，剩下的工作都已經在其他執行緒上執行，此時以condition variable睡到最後一個工作完成，
+//   不會空轉佔住CPU。
+class TaskGroup{
+  public:
+    explicit TaskGroup(ThreadPool& pool): pool_(pool) {}
+    ~TaskGroup() {
+        WaitAll();
     }
-    void PushFront(const T& val) {
-        int new_size = 2*(size_+1);
-        T* tmp = new T[new_size] {};
-        tmp[0] = val;
-        if(data_) {
-            for(int i = 0; i < size_; i++){
-                tmp[i+1] = data_[i];
+    template<typename F>
+    void Run(F f) {
+        remaining_++;
+        pool_.Submit([this, f] {
+            try {
+                f();
+            } catch(...) {
+                std::lock_guard<std::mutex> lock(mtx_);
+                if(!error_) error_ = std::current_exception();
             }
-            delete [] data_;
-        }
-        data_ = tmp;
-        size_++;
-        capacity_ = new_size;
+            // * 持有鎖時才遞減並通知：等待者必須拿到鎖才能確認remaining_歸零並解構TaskGroup，通知時物件一定還在。
+            std::lock_guard<std::mutex> lock(mtx_);
+            if(--remaining_ == 0) done_cv_.notify_all();
+        });
     }
-    T& Back() {
-        return data_[size_-1];
+    void Wait() {
+        WaitAll();
+        if(error_) std::rethrow_exception(std::exchange(error_, nullptr));
     }
-    const T& Back() const {
-        return data_[size_-1];
+  private:
+    // * 最後一定要拿鎖確認remaining_歸零：只讀atomic的話，最後一個工作可能還在notify，TaskGroup就先被解構了。
+    void WaitAll() {
+        while(remaining_ > 0 && pool_.RunPendingTask()) {}
+        std::unique_lock<std::mutex> lock(mtx_);
+        done_cv_.wait(lock, [this] { return remaining_ == 0; });
     }
-    T& Front() {
-        return data_[0];
+    ThreadPool& pool_;
+    std::atomic<int> remaining_{0};
+    std::mutex mtx_;
+    std::condition_variable done_cv_;
+    std::exception_ptr error_;
+};
+
+// * 平行演算法：Container為元素連續存放、提供Size()與operator[]的容器(STD::Vector、STD::Array)。
+//   grain為每個工作負責的元素數，0代表自動(約切成執行緒數的8倍個區塊)。
+inline std::size_t DefaultGrain(std::size_t n, const ThreadPool& pool) {
+    std::size_t tasks = pool.Size() * 8;
+    return std::max<std::size_t>(1, (n + tasks - 1) / tasks);
+}
+// * Vector<bool>每64個元素共用一個word，兩個區塊寫入同一個word會互相覆蓋(data race)，
+//   因此寫入Vector<bool>時區塊的邊界必須落在word的邊界上：grain要是kChunkAlign的倍數。
+template<typename Container>
+inline constexpr std::size_t kChunkAlign = 1;
+template<typename Allocator, typename Growth>
+inline constexpr std::size_t kChunkAlign<Vector<bool, Allocator, Growth>> = 64;
+template<typename Container>
+std::size_t ChunkGrain(std::size_t n, std::size_t grain, const ThreadPool& pool) {
+    if(grain == 0) grain = DefaultGrain(n, pool);
+    constexpr std::size_t kAlign = kChunkAlign<std::remove_const_t<Container>>;
+    return (grain + kAlign - 1) / kAlign * kAlign;
+}
+// * 把[0, n)切成長度grain的區塊平行呼叫body(first, last)，全部完成後才返回。
+//   body寫入Vector<bool>時，grain必須是64的倍數(見kChunkAlign)。
+template<typename F>
+void ParallelChunks(ThreadPool& pool, std::size_t n, std::size_t grain, F&& body) {
+    if(n == 0) return;
+    if(grain == 0) grain = DefaultGrain(n, pool);
+    if(grain >= n) {
+        body(0, n);
+        return;
     }
-    const T& Front() const {
-        return data_[0];
+    TaskGroup group(pool);
+    for(std::size_t first = 0; first < n; first += grain) {
+        std::size_t last = std::min(n, first + grain);
+        group.Run([&body, first, last] { body(first, last); });
     }
-    bool Empty() const {
-        return size_ == 0;
+    group.Wait();
+}
+template<typename Container, typename F>
+void ParallelForEach(ThreadPool& pool, Container& con, F f, std::size_t grain = 0) {
+    std::size_t n = con.Size();
+    ParallelChunks(pool, n, ChunkGrain<Container>(n, grain, pool), [&con, &f](std::size_t first, std::size_t last) {
+        for(std::size_t i = first; i < last; i++) {
+            f(con[i]);
+        }
+    });
+}
+// * out[i] = f(in[i])；out必須已經有至少in.Size()個元素。
+template<typename InContainer, typename OutContainer, typename F>
+void ParallelTransform(ThreadPool& pool, const InContainer& in, OutContainer& out, F f, std::size_t grain = 0) {
+    std::size_t n = in.Size();
+    ParallelChunks(pool, n, ChunkGrain<OutContainer>(n, grain, pool), [&in, &out, &f](std::size_t first, std::size_t last) {
+        for(std::size_t i = first; i < last; i++) {
+            out[i] = f(in[i]);
+        }
+    });
+}
+// * 區塊的切法只由grain決定(預設為固定的kReduceGrain，與執行緒數無關)，每個區塊由左到右歸約，
+//   最後再依區塊順序合併，因此即使是浮點數，不論排程或機器的核心數，結果都逐位元相同。
+inline constexpr std::size_t kReduceGrain = 1 << 16;
+template<typename Container, typename T, typename BinaryOp>
+T ParallelReduce(ThreadPool& pool, const Container& con, T init, BinaryOp op, std::size_t grain = kReduceGrain) {
+    std::size_t n = con.Size();
+    if(n == 0) return init;
+    if(grain == 0) grain = kReduceGrain;
+    std::size_t chunks = (n + grain - 1) / grain;
+    std::vector<T> partial(chunks);
+    ParallelChunks(pool, chunks, 1, [&](std::size_t first, std::size_t last) {
+        for(std::size_t c = first; c < last; c++) {
+            std::size_t begin = c * grain, end = std::min(n, begin + grain);
+            T acc = con[begin];
+            for(std::size_t i = begin + 1; i < end; i++) {
+                acc = op(acc, con[i]);
+            }
+            partial[c] = acc;
+        }
+    });
+    for(std::size_t c = 0; c < chunks; c++) {
+        init = op(init, partial[c]);
     }
-    void Fill(const T& val) {
-        for(int i = 0; i < size_; i++) {
-            data_[i] = val;
+    return init;
+}
+// * 平行合併排序：各區塊先以std::sort平行排序，再一輪一輪兩兩平行合併(每輪區塊長度加倍)，在原陣列與
+//   暫存Vector之間來回搬移。結果與單執行緒的std::sort相同(但不是stable sort)。
+template<typename Container, typename Compare = std::less<>>
+void ParallelSort(ThreadPool& pool, Container& con, Compare comp = Compare(), std::size_t grain = 0) {
+    using T = std::remove_reference_t<decltype(con[0])>;
+    std::size_t n = con.Size();
+    if(n <= 1) return;
+    if(grain == 0) grain = DefaultGrain(n, pool);
+    T* data = &con[0];
+    ParallelChunks(pool, n, grain, [&](std::size_t first, std::size_t last) {
+        std::sort(data + first, data + last, comp);
+    });
+    if(grain >= n) return;
+    Vector<T> buffer;
+    buffer.Append(data, data + n);
+    T* src = data;
+    T* dst = &buffer[0];
+    for(std::size_t width = grain; width < n; width *= 2) {
+        std::size_t pairs = (n + 2 * width - 1) / (2 * width);
+        ParallelChunks(pool, pairs, 1, [&](std::size_t first, std::size_t last) {
+            for(std::size_t p = first; p < last; p++) {
+                std::size_t lo = p * 2 * width, mid = std::min(n, lo + width), hi = std::min(n, lo + 2 * width);
+                std::merge(std::make_move_iterator(src + lo), std::make_move_iterator(src + mid),
+                           std::make_move_iterator(src + mid), std::make_move_iterator(src + hi),
+                           dst + lo, comp);
+            }
+        });
+        std::swap(src, dst);
+    }
+    if(src != data) {
+        ParallelChunks(pool, n, grain, [&](std::size_t first, std::size_t last) {
+            std::move(src + first, src + last, data + first);
+        });
+    }
+}
+
+// * 二進位序列化格式(version 1)：64 bytes的標頭後面緊接著元素的原始位元組。
+//   標頭記錄型別標記、元素大小、對齊需求、元素個數、位元組順序以及payload的checksum；payload從第64 byte開始，
+//   因此只要整塊緩衝區(例如mmap的結果)對齊到64 bytes，ViewBinary就能直接把它當成唯讀的陣列使用而不必複製。
+//   只支援trivially copyable的元素型別，數值以原始位元組存放，浮點數不會因文字轉換而失去精度。
+namespace binary{
+// * 型別標記：算術型別各有固定編號，其他trivially copyable的使用者型別為0(只檢查元素大小與對齊)。
+template<typename T> struct TypeTag: std::integral_constant<std::uint16_t, 0> {};
+template<> struct TypeTag<std::int8_t>: std::integral_constant<std::uint16_t, 1> {};
+template<> struct TypeTag<std::uint8_t>: std::integral_constant<std::uint16_t, 2> {};
+template<> struct TypeTag<std::int16_t>: std::integral_constant<std::uint16_t, 3> {};
+template<> struct TypeTag<std::uint16_t>: std::integral_constant<std::uint16_t, 4> {};
+template<> struct TypeTag<std::int32_t>: std::integral_constant<std::uint16_t, 5> {};
+template<> struct TypeTag<std::uint32_t>: std::integral_constant<std::uint16_t, 6> {};
+template<> struct TypeTag<std::int64_t>: std::integral_constant<std::uint16_t, 7> {};
+template<> struct TypeTag<std::uint64_t>: std::integral_constant<std::uint16_t, 8> {};
+template<> struct TypeTag<float>: std::integral_constant<std::uint16_t, 9> {};
+template<> struct TypeTag<double>: std::integral_constant<std::uint16_t, 10> {};
+template<> struct TypeTag<char>: std::integral_constant<std::uint16_t, 11> {};
+template<> struct TypeTag<bool>: std::integral_constant<std::uint16_t, 12> {};
+
+struct Header{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t byte_order;                   // * 寫入端的0x0102；讀到0x0201代表位元組順序不同。
+    std::uint16_t type_tag;
+    std::uint16_t reserved;
+    std::uint32_t elem_size;
+    std::uint32_t alignment;
+    std::uint32_t header_size;
+    std::uint64_t count;
+    std::uint64_t checksum;
+    char padding[24];
+};
+static_assert(sizeof(Header) == 64, "binary header must stay 64 bytes");
+inline constexpr char kMagic[4] = {'S', 'T', 'D', 'B'};
+inline constexpr std::uint16_t kVersion = 1;
+inline constexpr std::uint16_t kByteOrder = 0x0102;
+
+// * 64-bit checksum：一次處理8 bytes，以四條獨立的累加鏈讓CPU平行運算，速度遠高於逐位元組的FNV-1a。
+inline std::uint64_t Checksum(const void* data, std::size_t bytes) {
+    constexpr std::uint64_t kPrime = 0x100000001b3ULL;
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::uint64_t h[4] = {0xcbf29ce484222325ULL, 0x84222325cbf29ce4ULL, 0x9ce484222325cbf2ULL, 0x2325cbf29ce48422ULL};
+    std::size_t i = 0;
+    for(; i + 32 <= bytes; i += 32) {
+        for(int k = 0; k < 4; k++) {
+            std::uint64_t w;
+            std::memcpy(&w, p + i + 8 * k, 8);
+            h[k] = (h[k] ^ w) * kPrime;
+            h[k] ^= h[k] >> 29;
         }
     }
-    void Swap(Vector& other) {
-        std::swap(other, *this);                // * 在C++11中，若待交換的類別有支援移動建構子以及移動賦值運算子(有實作)的話，
-                                                //   std::swap()就會使用移動的方式，如果沒有時做上述兩者的話，則會觸發複製建
-                                                //   構子以及複製賦值運算子，交換的結果會比較耗時。
+    std::uint64_t res = h[0] ^ (h[1] * 3) ^ (h[2] * 5) ^ (h[3] * 7);
+    for(; i < bytes; i++) {
+        res = (res ^ p[i]) * kPrime;
+    }
+    return (res ^ bytes) * kPrime;
+}
+template<typename T>
+Header MakeHeader(const T* data, std::size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "binary format stores elements as raw bytes");
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrder;
+    header.type_tag = TypeTag<T>::value;
+    header.elem_size = sizeof(T);
+    header.alignment = alignof(T);
+    header.header_size = sizeof(Header);
+    header.count = count;
+    header.checksum = Checksum(data, count * sizeof(T));
+    return header;
+}
+template<typename T>
+void CheckHeader(const Header& header) {
+    if(std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) throw std::runtime_error("Binary Format Error: bad magic");
+    if(header.version != kVersion) throw std::runtime_error("Binary Format Error: unsupported version");
+    if(header.byte_order != kByteOrder) throw std::runtime_error("Binary Format Error: byte order mismatch");
+    if(header.header_size != sizeof(Header)) throw std::runtime_error("Binary Format Error: unsupported header size");
+    if(header.type_tag != TypeTag<T>::value || header.elem_size != sizeof(T) || header.alignment != alignof(T)) {
+        throw std::runtime_error("Binary Format Error: element type mismatch");
+    }
+}
+template<typename T>
+void WriteBinary(const T* data, std::size_t count, std::ostream& os) {
+    Header header = MakeHeader(data, count);
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    os.write(reinterpret_cast<const char*>(data), count * sizeof(T));
+    if(!os) throw std::runtime_error("Binary Format Error: write failed");
+}
+inline Header ReadHeader(std::istream& is) {
+    Header header;
+    if(!is.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+        throw std::runtime_error("Binary Format Error: truncated header");
+    }
+    return header;
+}
+// * 串流從目前位置到結尾還剩幾個bytes；不能seek的串流(例如pipe、socket)回傳npos，表示未知。
+inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+inline std::size_t RemainingBytes(std::istream& is) {
+    std::istream::pos_type here = is.tellg();
+    if(here == std::istream::pos_type(-1)) {
+        is.clear();
+        return npos;
+    }
+    if(!is.seekg(0, std::ios::end)) {
+        is.clear();
+        is.seekg(here);
+        return npos;
+    }
+    std::istream::pos_type end = is.tellg();
+    is.seekg(here);
+    return end == std::istream::pos_type(-1) || end < here ? npos : static_cast<std::size_t>(end - here);
+}
+// * 每次最多讀入1 MiB：標頭中的count尚未驗證，不能照它一次配置整個緩衝區。
+inline constexpr std::size_t kReadChunkBytes = std::size_t{1} << 20;
+}
 
-        // std::swap(other.data_, data_);         // * 如果Vector沒有實作移動建構子以及移動賦值運算子時要採取此種寫法來移動內
-        // std::swap(other.size_, size_);         //   部資源，避免std::swap去針對整個Vector做複製建構以及複製賦值運算，花費
-        // std::swap(other.capacity_, capacity_); //   大量的時間。
+template<typename T, typename Allocator, typename Growth>
+void SaveBinary(const Vector<T, Allocator, Growth>& vec, std::ostream& os) {
+    binary::WriteBinary(vec.Empty() ? nullptr : &vec[0], vec.Size(), os);
+}
+template<typename T, typename Allocator = std::allocator<T>>
+Vector<T, Allocator> LoadBinary(std::istream& is, const Allocator& alloc = Allocator()) {
+    binary::Header header = binary::ReadHeader(is);
+    binary::CheckHeader<T>(header);
+    Vector<T, Allocator> vec(alloc);
+    if(header.count > vec.MaxSize()) throw std::runtime_error("Binary Format Error: too many elements for Vector");
+    // * 標頭可能是偽造或截斷的：能seek的串流先確認payload真的有count個元素才一次保留容量；
+    //   不能seek時分段讀取，容量只隨實際讀到的資料成長，損壞的檔案不會先配置出count個元素的記憶體。
+    std::size_t remaining = binary::RemainingBytes(is);
+    if(remaining != binary::npos) {
+        if(header.count > remaining / sizeof(T)) throw std::runtime_error("Binary Format Error: truncated payload");
+        vec.Reserve(header.count);
     }
-    class ConstIterator{
-      public:
-        ConstIterator(const T* ptr): ptr_(ptr) {}
-        bool operator!=(const ConstIterator& other) {
-            return ptr_ != other.ptr_;
-        }
-        const T& operator*() {
-            return *ptr_;
-        }
-        const T* operator++(int) {
-            return ptr_++;
+    constexpr std::size_t kChunk = std::max<std::size_t>(1, binary::kReadChunkBytes / sizeof(T));
+    for(std::size_t done = 0; done < header.count;) {
+        std::size_t n = std::min<std::size_t>(kChunk, header.count - done);
+        vec.Resize(done + n);
+        if(!is.read(reinterpret_cast<char*>(&vec[done]), n * sizeof(T))) {
+            throw std::runtime_error("Binary Format Error: truncated payload");
         }
-      private:
-        const T* ptr_;
-    };
+        done += n;
+    }
+    if(binary::Checksum(header.count ? &vec[0] : nullptr, header.count * sizeof(T)) != header.checksum) {
+        throw std::runtime_error("Binary Format Error: checksum mismatch");
+    }
+    return vec;
+}
+
+// * VectorView: 直接指向序列化緩衝區中payload的唯讀Vector，不配置也不複製任何元素；
+//   緩衝區(例如mmap映射的檔案)必須在VectorView使用期間保持有效。
+template<typename T>
+class VectorView{
+  public:
+    using value_type = T;
+    using ConstIterator = ContiguousIterator<const T>;
+    using const_iterator = ConstIterator;
+    VectorView(const T* data, std::size_t size): data_(data), size_(size) {}
+    const T& operator[](std::size_t id) const {
+        return data_[id];
+    }
+    std::size_t Size() const {
+        return size_;
+    }
+    bool Empty() const {
+        return size_ == 0;
+    }
+    const T& Front() const {
+        return data_[0];
+    }
+    const T& Back() const {
+        return data_[size_-1];
+    }
     ConstIterator Begin() const {
-        return {&data_[0]};
+        return {data_};
     }
     ConstIterator End() const {
-        return {&data_[size_]};
+        return {data_ + size_};
+    }
+    const T* data() const {
+        return data_;
+    }
+    std::size_t size() const {
+        return size_;
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    ConstIterator end() const {
+        return End();
     }
   private:
-    int size_{};
-    int capacity_{};
-    T* data_{};
+    const T* data_;
+    std::size_t size_;
 };
-
+// * verify_checksum為false時完全不讀取payload(例如想讓mmap的頁面按需載入時)。
 template<typename T>
-typename Vector<T>::ConstIterator Begin(const Vector<T>& vec) {
-    return vec.Begin();
+VectorView<T> ViewBinary(const void* buffer, std::size_t bytes, bool verify_checksum = true) {
+    if(bytes < sizeof(binary::Header)) throw std::runtime_error("Binary Format Error: truncated header");
+    binary::Header header;
+    std::memcpy(&header, buffer, sizeof(header));
+    binary::CheckHeader<T>(header);
+    if(header.count > (bytes - sizeof(header)) / sizeof(T)) throw std::runtime_error("Binary Format Error: truncated payload");
+    const char* payload = static_cast<const char*>(buffer) + sizeof(header);
+    if(reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) {
+        throw std::runtime_error("Binary Format Error: misaligned buffer");
+    }
+    if(verify_checksum && binary::Checksum(payload, header.count * sizeof(T)) != header.checksum) {
+        throw std::runtime_error("Binary Format Error: checksum mismatch");
+    }
+    return {reinterpret_cast<const T*>(payload), header.count};
 }
 template<typename T>
-typename Vector<T>::ConstIterator End(const Vector<T>& vec) {
-    return vec.End();
+typename VectorView<T>::ConstIterator Begin(const VectorView<T>& view) {
+    return view.Begin();
+}
+template<typename T>
+typename VectorView<T>::ConstIterator End(const VectorView<T>& view) {
+    return view.End();
 }
-
 template<typename T>
-std::ostream& operator<<(std::ostream& os, const Vector<T>& vec) {
+std::ostream& operator<<(std::ostream& os, const VectorView<T>& view) {
     os << "[";
-    // for(int i = 0; i < vec.size_; i++) {
-    //     if(i != 0) os << ", ";
-    //     os << vec[i];
-    // }
-    for(typename Vector<T>::ConstIterator it = Begin(vec); it != End(vec); it++) {
-        if(it != Begin(vec)) os << ", ";
+    for(typename VectorView<T>::ConstIterator it = Begin(view); it != End(view); it++) {
+        if(it != Begin(view)) os << ", ";
         os << *it;
     }
     os << "]";
     return os;
 }
+
+// * 無分支(branchless)的lower_bound：每一輪只依比較結果決定base要不要前進(編譯成cmov)，沒有難以預測的分支，
+//   搜尋範圍每輪減半，對放在連續記憶體中的小型查詢表特別快。
+template<typename T, typename Key, typename Compare>
+std::size_t BranchlessLowerBound(const T* first, std::size_t n, const Key& key, Compare comp) {
+    if(n == 0) return 0;
+    const T* base = first;
+    while(n > 1) {
+        std::size_t half = n / 2;
+        base = comp(base[half], key) ? base + half : base;
+        n -= half;
+    }
+    return (base - first) + comp(*base, key);
+}
+
+// * FlatSet: 以排序過的Vector實作的集合。與Set的每個元素一個串列節點不同，所有元素都在同一塊連續記憶體中，
+//   查詢是對連續陣列的二分搜尋，走訪也是循序存取，適合建好之後以查詢為主的表。
+//   單一元素的Insert/Erase需要搬移後面的元素(O(n))，大量新增請用InsertRange：新元素接在尾端一次排序後再與原本的部分合併。
+template<typename T, typename Compare = std::less<T>>
+class FlatSet{
+  public:
+    using ConstIterator = typename Vector<T>::ConstIterator;
+    static constexpr std::size_t npos = Vector<T>::npos;
+    FlatSet() = default;
+    FlatSet(const std::initializer_list<T> lst) {
+        InsertRange(lst.begin(), lst.end());
+    }
+    // * 大量建構：全部放入後只排序一次，再去除重複的元素。
+    template<typename InputIt>
+    FlatSet(InputIt first, InputIt last) {
+        InsertRange(first, last);
+    }
+    std::size_t Size() const {
+        return data_.Size();
+    }
+    bool Empty() const {
+        return data_.Empty();
+    }
+    const T& operator[](std::size_t id) const {
+        return data_[id];
+    }
+    // * 第一個不小於key的元素索引。
+    std::size_t LowerBound(const T& key) const {
+        return BranchlessLowerBound(data_.data(), data_.Size(), key, comp_);
+    }
+    // * 找到時回傳索引，否則回傳npos。
+    std::size_t Find(const T& key) const {
+        std::size_t id = LowerBound(key);
+        return id < Size() && !comp_(key, data_[id]) ? id : npos;
+    }
+    bool Contains(const T& key) const {
+        return Find(key) != npos;
+    }
+    bool Insert(const T& key) {
+        std::size_t id = LowerBound(key);
+        if(id < Size() && !comp_(key, data_[id])) return false;
+        data_.InsertRange(id, &key, &key + 1);
+        return true;
+    }
+    // * 批次合併新增：新元素接在尾端排序，再以inplace_merge與原本已排序的部分合併，最後去除重複；
+    //   k個新元素的成本是O(k log k + n)，而不是逐一Insert的O(k * n)。
+    template<typename InputIt>
+    void InsertRange(InputIt first, InputIt last) {
+        std::size_t old_size = Size();
+        data_.Append(first, last);
+        std::sort(data_.begin() + old_size, data_.end(), comp_);
+        std::inplace_merge(data_.begin(), data_.begin() + old_size, data_.end(), comp_);
+        auto equal = [this](const T& a, const T& b) { return !comp_(a, b) && !comp_(b, a); };
+        std::size_t unique_size = std::unique(data_.begin(), data_.end(), equal) - data_.begin();
+        while(Size() > unique_size) {
+            data_.PopBack();
+        }
+    }
+    bool Erase(const T& key) {
+        std::size_t id = Find(key);
+        if(id == npos) return false;
+        std::move(data_.begin() + id + 1, data_.end(), data_.begin() + id);
+        data_.PopBack();
+        return true;
+    }
+    void Clear() {
+        data_.Clear();
+    }
+    ConstIterator Begin() const {
+        return data_.Begin();
+    }
+    ConstIterator End() const {
+        return data_.End();
+    }
+    ConstIterator begin() const {
+        return Begin();
+    }
+    ConstIterator end() const {
+        return End();
+    }
+  private:
+    Vector<T> data_;
+    Compare comp_{};
+};
+
+// * FlatMap: 以兩個平行的排序Vector(keys_與values_)實作的對應表。搜尋只需要讀keys_，
+//   值不會被一起載入cache，因此鍵很小而值很大時，查詢所需的cache line更少。
+template<typename K, typename V, typename Compare = std::less<K>>
+class FlatMap{
+  public:
+    static constexpr std::size_t npos = Vector<K>::npos;
+    FlatMap() = default;
+    FlatMap(const std::initializer_list<std::pair<K, V>> lst) {
+        InsertRange(lst.begin(), lst.end());
+    }
+    template<typename InputIt>
+    FlatMap(InputIt first, InputIt last) {
+        InsertRange(first, last);
+    }
+    std::size_t Size() const {
+        return keys_.Size();
+    }
+    bool Empty() const {
+        return keys_.Empty();
+    }
+    std::size_t LowerBound(const K& key) const {
+        return BranchlessLowerBound(keys_.data(), keys_.Size(), key, comp_);
+    }
+    std::size_t Find(const K& key) const {
+        std::size_t id = LowerBound(key);
+        return id < Size() && !comp_(key, keys_[id]) ? id : npos;
+    }
+    bool Contains(const K& key) const {
+        return Find(key) != npos;
+    }
+    const K& KeyAt(std::size_t id) const {
+        return keys_[id];
+    }
+    V& ValueAt(std::size_t id) {
+        return values_[id];
+    }
+    const V& ValueAt(std::size_t id) const {
+        return values_[id];
+    }
+    V& At(const K& key) {
+        std::size_t id = Find(key);
+        if(id == npos) throw std::out_of_range("FlatMap Key Not Found");
+        return values_[id];
+    }
+    const V& At(const K& key) const {
+        std::size_t id = Find(key);
+        if(id == npos) throw std::out_of_range("FlatMap Key Not Found");
+        return values_[id];
+    }
+    // * 鍵不存在時插入值初始化的V。
+    V& operator[](const K& key) {
+        std::size_t id = LowerBound(key);
+        if(id == Size() || comp_(key, keys_[id])) InsertAt(id, key, V());
+        return values_[id];
+    }
+    // * 鍵已經存在時不會覆寫，回傳false(與std::map::insert相同)。
+    bool Insert(const K& key, const V& val) {
+        std::size_t id = LowerBound(key);
+        if(id < Size() && !comp_(key, keys_[id])) return false;
+        InsertAt(id, key, val);
+        return true;
+    }
+    // * 批次合併新增：新的鍵值對先穩定排序並去除重複的鍵(保留最先出現的)，再與現有的表做一次線性合併；
+    //   已經存在的鍵保留原本的值。
+    template<typename InputIt>
+    void InsertRange(InputIt first, InputIt last) {
+        Vector<std::pair<K, V>> batch;
+        batch.Append(first, last);
+        auto by_key = [this](const std::pair<K, V>& a, const std::pair<K, V>& b) { return comp_(a.first, b.first); };
+        std::stable_sort(batch.begin(), batch.end(), by_key);
+        Vector<K> keys;
+        Vector<V> values;
+        keys.Reserve(Size() + batch.Size());
+        values.Reserve(Size() + batch.Size());
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while(i < Size() || j < batch.Size()) {
+            if(j == batch.Size() || (i < Size() && !comp_(batch[j].first, keys_[i]))) {
+                while(j < batch.Size() && !comp_(keys_[i], batch[j].first)) {
+                    j++;                        // * 與現有的鍵相同，略過。
+                }
+                keys.PushBack(std::move(keys_[i]));
+                values.PushBack(std::move(values_[i]));
+                i++;
+            } else {
+                keys.PushBack(std::move(batch[j].first));
+                values.PushBack(std::move(batch[j].second));
+                const K& added = keys.Back();
+                while(j < batch.Size() && !comp_(added, batch[j].first)) {
+                    j++;                        // * 批次中重複的鍵只保留第一個。
+                }
+            }
+        }
+        keys_.Swap(keys);
+        values_.Swap(values);
+    }
+    bool Erase(const K& key) {
+        std::size_t id = Find(key);
+        if(id == npos) return false;
+        std::move(keys_.begin() + id + 1, keys_.end(), keys_.begin() + id);
+        std::move(values_.begin() + id + 1, values_.end(), values_.begin() + id);
+        keys_.PopBack();
+        values_.PopBack();
+        return true;
+    }
+    void Clear() {
+        keys_.Clear();
+        values_.Clear();
+    }
+    const Vector<K>& Keys() const {
+        return keys_;
+    }
+    const Vector<V>& Values() const {
+        return values_;
+    }
+  private:
+    void InsertAt(std::size_t id, const K& key, const V& val) {
+        keys_.InsertRange(id, &key, &key + 1);
+        try {
+            values_.InsertRange(id, &val, &val + 1);
+        } catch(...) {                          // * 兩個Vector的大小必須一致，值插入失敗時把鍵移除。
+            std::move(keys_.begin() + id + 1, keys_.end(), keys_.begin() + id);
+            keys_.PopBack();
+            throw;
+        }
+    }
+    Vector<K> keys_;
+    Vector<V> values_;
+    Compare comp_{};
+};
+
+template<typename T, typename Compare>
+std::ostream& operator<<(std::ostream& os, const FlatSet<T, Compare>& set) {
+    os << "{";
+    for(std::size_t i = 0; i < set.Size(); i++) {
+        if(i) os << ", ";
+        os << set[i];
+    }
+    os << "}";
+    return os;
+}
+template<typename K, typename V, typename Compare>
+std::ostream& operator<<(std::ostream& os, const FlatMap<K, V, Compare>& map) {
+    os << "{";
+    for(std::size_t i = 0; i < map.Size(); i++) {
+        if(i) os << ", ";
+        os << map.KeyAt(i) << ": " << map.ValueAt(i);
+    }
+    os << "}";
+    return os;
+}
 }
 
 template<typename T>
@@ -233,5 +2489,208 @@ int main() {
     vd.Swap(v);
     std::cout << vd << std::endl; // [5, 5, 5, 5, 5]
     std::cout << v << std::endl;  // [5, 4, 3, 2, 1, 1, 0, 0, 0, 0, 666]
+    STD::Vector<std::string> vs;
+    vs.EmplaceBack(3, 'a');       // * 直接在容器的記憶體上以std::string(3, 'a')建構，不產生暫存物件。
+    vs.PushBack("bb");
+    vs.EmplaceBack(vs[0]);        // * 參考到自身元素時，即使觸發重新配置也安全。
+    std::cout << vs << std::endl; // [aaa, bb, aaa]
+    std::cout << vs.Size() << std::endl; // 3
+    STD::Vector<float> vf;
+    for(int i = 0; i < 5; i++) {
+        vf.PushBack(i * 0.5f);    // * float可逐位元組搬移，擴充時走realloc。
+    }
+    std::cout << vf << std::endl; // [0, 0.5, 1, 1.5, 2]
+    STD::Vector<STD::Vector<int>> vv;
+    vv.PushBack({1, 2});
+    vv.PushBack({3});
+    vv.PushBack(vv[0]);
+    std::cout << vv << std::endl; // [[1, 2], [3], [1, 2]]
+    STD::Vector<std::string> events;
+    for(int i = 0; i < 3; i++) {
+        events.PushFront("f" + std::to_string(i));
+        events.PushBack("b" + std::to_string(i));
+    }
+    std::cout << events << std::endl; // [f2, f1, f0, b0, b1, b2]
+    events.PopFront();
+    events.PopBack();
+    events.EmplaceFront("f9");
+    std::cout << events << std::endl; // [f9, f1, f0, b0, b1]
+    STD::Vector<int> batch;
+    batch.Reserve(8);
+    std::cout << batch.Capacity() << std::endl; // 8
+    int raw[] = {1, 2, 3, 4};
+    batch.Append(raw, raw + 4);                 // * 容量已足夠，不重新配置。
+    batch.InsertRange(1, raw + 2, raw + 4);
+    std::cout << batch << std::endl;            // [1, 3, 4, 2, 3, 4]
+    batch.InsertRange(0, &batch[3], &batch[6]); // * 參考到自身元素的區間，觸發重新配置也安全。
+    std::cout << batch << std::endl;            // [2, 3, 4, 1, 3, 4, 2, 3, 4]
+    batch.ShrinkToFit();
+    std::cout << batch.Capacity() << std::endl; // 9
+    STD::Vector<float> samples(1000);
+    samples.Fill(0.5f);                         // * 以機器支援的最寬SIMD指令(SSE2/AVX2/AVX-512)執行。
+    samples[700] = -3.0f;
+    samples[999] = 4.0f;
+    std::cout << samples.Find(-3.0f) << " " << samples.Count(0.5f) << std::endl;    // 700 998
+    std::cout << samples.Min() << " " << samples.Max() << std::endl;                // -3 4
+    std::cout << samples.Sum() << " " << samples.Dot(samples) << std::endl;         // 500 274.5
+    {
+        STD::ThreadPool pool(4);
+        STD::Vector<long long> nums(100000);
+        nums.Fill(1);
+        STD::ParallelForEach(pool, nums, [](long long& x) { x *= 2; });
+        std::cout << STD::ParallelReduce(pool, nums, 0LL, std::plus<>()) << std::endl; // 200000
+        STD::Vector<int> keys(100000);
+        for(std::size_t i = 0; i < keys.Size(); i++) {
+            keys[i] = (i * 7919) % keys.Size();
+        }
+        STD::ParallelSort(pool, keys, std::greater<>(), 4096);                       // * 區塊大小可調。
+        std::cout << keys.Front() << " " << keys[1] << " " << keys.Back() << std::endl; // 99999 99998 0
+        STD::Vector<double> halves(keys.Size());
+        STD::ParallelTransform(pool, keys, halves, [](int k) { return k / 2.0; });
+        std::cout << halves.Front() << std::endl;                                     // 49999.5
+    }
+    {
+        STD::Vector<double> prices {1.0 / 3, 2.5, -1e-300};
+        std::stringstream ss;
+        STD::SaveBinary(prices, ss);                  // * 原始位元組，不經文字轉換，精度完全保留。
+        STD::Vector<double> loaded = STD::LoadBinary<double>(ss);
+        std::cout << (loaded[0] == prices[0]) << " " << loaded << std::endl; // 1 [0.333333, 2.5, -1e-300]
+        std::string bytes = ss.str();
+        STD::VectorView<double> view = STD::ViewBinary<double>(bytes.data(), bytes.size());
+        std::cout << view.Size() << " " << view[1] << std::endl;             // 3 2.5
+        std::cout << std::accumulate(view.begin(), view.end(), 0.0) << std::endl; // 2.83333
+        bytes[70] ^= 1;
+        try {
+            STD::ViewBinary<double>(bytes.data(), bytes.size());
+        } catch(const std::runtime_error& e) {
+            std::cout << e.what() << std::endl;       // Binary Format Error: checksum mismatch
+        }
+    }
+    {
+        STD::Vector<int> keys {42, 7, 19, 3, 88, 7};
+        std::sort(keys.begin(), keys.end());          // * 直接在Vector上排序，不必先複製到std::vector。
+        std::cout << keys << std::endl;               // [3, 7, 7, 19, 42, 88]
+        auto it = std::lower_bound(keys.begin(), keys.end(), 19);
+        std::cout << it - keys.begin() << " " << std::size(keys) << std::endl; // 3 6
+        for(int& key: keys) {
+            key *= 2;
+        }
+        std::cout << std::reduce(keys.begin(), keys.end()) << std::endl; // 332
+        STD::Vector<int>::ConstIterator last = std::prev(keys.end());
+        std::cout << *last << " " << (last > keys.begin()) << std::endl; // 176 1
+    }
+    {
+        namespace growth = STD::growth;
+        STD::Vector<int, std::allocator<int>, growth::Tracked<growth::Doubling>> doubling;
+        STD::Vector<int, std::allocator<int>, growth::Tracked<growth::OneAndHalf>> one_and_half;
+        STD::Vector<int, std::allocator<int>, growth::Tracked<growth::SizeClass<>>> size_class;
+        STD::Vector<int, std::allocator<int>, growth::Tracked<growth::FixedStep<256>>> fixed;
+        for(int i = 0; i < 1000; i++) {
+            doubling.PushBack(i);
+            one_and_half.PushBack(i);
+            size_class.PushBack(i);
+            fixed.PushBack(i);
+        }
+        // * 重新配置的次數、搬移的位元組數與最終容量之間的取捨。
+        auto report = [](const auto& vec) {
+            const STD::VectorStats& stats = vec.Stats();
+            std::cout << stats.reallocations << " " << stats.bytes_moved << " " << stats.peak_capacity << std::endl;
+        };
+        report(doubling);                             // 11 4092 1024
+        report(one_and_half);                         // 18 8548 1066
+        report(size_class);                           // 10 4088 1024
+        report(fixed);                                // 4 6144 1024
+        STD::Vector<char, std::allocator<char>, growth::PageRounded<>> page;
+        page.Resize(5000);
+        std::cout << page.Capacity() << std::endl;    // 8192
+    }
+    {
+        STD::Vector<long long> huge;
+        try {
+            huge.Reserve(huge.MaxSize() + 1);         // * 容量的計算不會溢位，而是拋出例外。
+        } catch(const std::length_error& e) {
+            std::cout << e.what() << std::endl;       // Vector Too Large
+        }
+        huge.Resize(std::size_t{3} << 21);            // * 48 MiB的緩衝區，以2 MiB對齊配置並使用透明大分頁。
+        huge.Back() = 7;
+        std::cout << huge.Size() << " " << huge.Find(7) << " " << (huge.Find(8) == huge.npos) << std::endl; // 6291456 6291455 1
+    }
+    {
+        STD::Vector<bool> visited(200, false);        // * 200個旗標只佔4個word(32 bytes)。
+        for(std::size_t i = 0; i < visited.Size(); i += 7) {
+            visited[i] = true;
+        }
+        std::cout << visited.Count() << " " << visited.FindFirst(false) << " " << visited.FindNext(0) << std::endl; // 29 1 7
+        STD::Vector<bool> evens(200, false);
+        for(std::size_t i = 0; i < evens.Size(); i += 2) {
+            evens[i] = true;
+        }
+        visited.And(evens);                           // * 同時是7與2的倍數，也就是14的倍數。
+        std::cout << visited.Count() << " " << visited.FindNext(14) << std::endl;   // 15 28
+        visited.Flip();
+        std::cout << visited.Count() << " " << visited.FindFirst() << std::endl;    // 185 1
+        STD::Vector<bool> flags {true, false, true};
+        flags.PushBack(flags[0]);
+        flags.Back().Flip();
+        std::cout << flags << std::endl;              // [1, 0, 1, 0]
+        try {
+            flags.Resize(flags.MaxSize() + 1);
+        } catch(const std::length_error& e) {
+            std::cout << e.what() << std::endl;       // Vector Too Large
+        }
+    }
+    {
+        STD::Vector<double> a {1, -4, 9, -16};
+        STD::Vector<double> b {0.5, 0.5, 0.5, 0.5};
+        STD::Vector<double> c = a * 2 + b;            // * 一個迴圈算完，沒有a * 2的暫存Vector。
+        std::cout << c << std::endl;                  // [2.5, -7.5, 18.5, -31.5]
+        c = STD::Sqrt(STD::Abs(a)) - 1.0 / b;
+        std::cout << c << std::endl;                  // [-1, 0, 1, 2]
+        a = a * a - a;                                // * 運算式中出現被賦值的Vector本身也沒關係。
+        std::cout << a << std::endl;                  // [0, 20, 72, 272]
+        STD::Vector<bool> mask = STD::Greater(c, 0.5);
+        std::cout << mask << " " << mask.Count() << std::endl; // [0, 0, 1, 1] 2
+        std::cout << (a == a) << (a < c) << (STD::Vector<int>{1, 2} < STD::Vector<int>{1, 2, 0}) << std::endl; // 101
+        try {
+            STD::Vector<double> bad = a + STD::Vector<double>(3);
+        } catch(const std::invalid_argument& e) {
+            std::cout << e.what() << std::endl;       // Expression Size Mismatch
+        }
+    }
+    {
+        int ids[] = {42, 7, 19, 7, 3, 88};
+        STD::FlatSet<int> set(ids, ids + 6);          // * 全部放入後只排序一次。
+        std::cout << set << " " << set.Contains(19) << set.Contains(20) << std::endl; // {3, 7, 19, 42, 88} 10
+        int more[] = {20, 1, 42, 100};
+        set.InsertRange(more, more + 4);              // * 批次合併，而不是逐一插入。
+        set.Erase(7);
+        std::cout << set << " " << set.Find(42) << std::endl; // {1, 3, 19, 20, 42, 88, 100} 4
+        STD::FlatMap<std::string, int> ages {{"bob", 31}, {"alice", 28}, {"bob", 99}};
+        ages["carol"] = 45;
+        ages.Insert("alice", 0);                      // * 鍵已存在，不覆寫。
+        std::cout << ages << std::endl;               // {alice: 28, bob: 31, carol: 45}
+        std::pair<std::string, int> batch[] = {{"dave", 52}, {"bob", 1}, {"aaron", 19}};
+        ages.InsertRange(batch, batch + 3);
+        ages.Erase("carol");
+        std::cout << ages << " " << ages.At("dave") << std::endl; // {aaron: 19, alice: 28, bob: 31, dave: 52} 52
+    }
+    {
+        // * 以一塊monotonic arena支撐一整批容器：個別元素/緩衝區的釋放都是no-op，離開scope時arena一次釋放全部記憶體。
+        std::pmr::monotonic_buffer_resource arena;
+        STD::Vector<int, std::pmr::polymorphic_allocator<int>> pa(&arena);
+        STD::Vector<int, std::pmr::polymorphic_allocator<int>> pb({7, 8}, &arena);
+        for(int i = 0; i < 4; i++) {
+            pa.PushBack(i);
+        }
+        pa.PushFront(-1);
+        pb = pa;
+        std::cout << pb << std::endl; // [-1, 0, 1, 2, 3]
+        std::cout << (pb.GetAllocator().resource() == &arena) << std::endl; // 1
+        // * 元素經由配置器建構：uses-allocator的元素(pmr::string)也拿到同一個arena，字串內容不會配置在全域heap上。
+        STD::Vector<std::pmr::string, std::pmr::polymorphic_allocator<std::pmr::string>> names(&arena);
+        names.EmplaceBack("a string long enough to need its own heap block");
+        names.PushFront(names[0]);
+        std::cout << (names[0].get_allocator().resource() == &arena) << (names[1].get_allocator().resource() == &arena) << std::endl; // 11
+    }
     return 0;
 }
\ No newline at end of file